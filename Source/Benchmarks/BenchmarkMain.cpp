@@ -0,0 +1,33 @@
+#include <juce_core/juce_core.h>
+#include <juce_events/juce_events.h>
+
+//==============================================================================
+/**
+ * TapMatrix benchmarks
+ *
+ * Console runner for the unit tests in the "Benchmarks" category. Each one times
+ * a hot path of the plugin (and its alternative, where there is one) and logs
+ * the figures; the expectations only guard that the timed code still works.
+ *
+ * Usage: TapMatrixBenchmarks [test name]   (runs every benchmark by default)
+ */
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    juce::UnitTestRunner runner;
+    runner.setAssertOnFailure (false);
+
+    juce::Array<juce::UnitTest*> tests;
+    for (auto* test : juce::UnitTest::getTestsInCategory ("Benchmarks"))
+        if (argc < 2 || test->getName() == juce::String (argv[1]))
+            tests.add (test);
+
+    runner.runTests (tests);
+
+    int failures = 0;
+    for (int i = 0; i < runner.getNumResults(); ++i)
+        failures += runner.getResult (i)->failures;
+
+    return failures > 0 ? 1 : 0;
+}
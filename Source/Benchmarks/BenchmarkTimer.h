@@ -0,0 +1,34 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+//==============================================================================
+/**
+ * Timing helpers shared by the benchmarks
+ */
+namespace Benchmark
+{
+    static constexpr int warmUpIterations = 10;
+
+    /** Mean wall-clock time of one call to fn, in milliseconds, after a few untimed warm-up calls */
+    template <typename Function>
+    double meanMilliseconds (int iterations, Function&& fn)
+    {
+        for (int i = 0; i < warmUpIterations; ++i)
+            fn();
+
+        const auto startTicks = juce::Time::getHighResolutionTicks();
+
+        for (int i = 0; i < iterations; ++i)
+            fn();
+
+        const auto elapsedTicks = juce::Time::getHighResolutionTicks() - startTicks;
+        return juce::Time::highResolutionTicksToSeconds (elapsedTicks) * 1000.0 / juce::jmax (1, iterations);
+    }
+
+    /** A time in milliseconds as microseconds, for logging */
+    inline juce::String formatMicroseconds (double milliseconds)
+    {
+        return juce::String (milliseconds * 1000.0, 1) + " us";
+    }
+}
@@ -0,0 +1,81 @@
+#include "../PluginProcessor.h"
+#include "BenchmarkTimer.h"
+
+//==============================================================================
+/**
+ * Audio engine cost at single and double precision: the same preset and input
+ * processed by each engine, as a DAW running the plugin in that precision would
+ */
+class ProcessingPrecisionBenchmark : public juce::UnitTest
+{
+public:
+    ProcessingPrecisionBenchmark() : juce::UnitTest ("Processing precision", "Benchmarks") {}
+
+    void runTest() override
+    {
+        beginTest ("Float vs double processing");
+        {
+            const double floatMs = measureBlockMilliseconds<float>();
+            const double doubleMs = measureBlockMilliseconds<double>();
+
+            const double blockMs = 1000.0 * blockSize / sampleRate;
+
+            logMessage ("Mean time per " + juce::String (blockSize) + "-sample stereo block at "
+                        + juce::String (sampleRate / 1000.0, 1) + " kHz over " + juce::String (timedBlocks) + " blocks:");
+            logMessage ("  float:  " + Benchmark::formatMicroseconds (floatMs)
+                        + " (" + juce::String (100.0 * floatMs / blockMs, 2) + "% of real time)");
+            logMessage ("  double: " + Benchmark::formatMicroseconds (doubleMs)
+                        + " (" + juce::String (100.0 * doubleMs / blockMs, 2) + "% of real time, "
+                        + juce::String (doubleMs / juce::jmax (1.0e-9, floatMs), 2) + "x float)");
+
+            expect (floatMs < blockMs && doubleMs < blockMs, "Processing slower than real time");
+        }
+    }
+
+private:
+    static constexpr double sampleRate = 48000.0;
+    static constexpr int blockSize = 512;
+    static constexpr int numChannels = 2;
+    static constexpr int timedBlocks = 2000;
+
+    template <typename SampleType>
+    double measureBlockMilliseconds()
+    {
+        TapMatrixAudioProcessor processor;
+
+        // A preset with every tap, reverb and crosstalk in use
+        processor.setCurrentProgram (4);
+
+        processor.setProcessingPrecision (std::is_same_v<SampleType, double> ? juce::AudioProcessor::doublePrecision
+                                                                                : juce::AudioProcessor::singlePrecision);
+        processor.setPlayConfigDetails (numChannels, numChannels, sampleRate, blockSize);
+        processor.prepareToPlay (sampleRate, blockSize);
+
+        juce::AudioBuffer<SampleType> input (numChannels, blockSize);
+        juce::AudioBuffer<SampleType> buffer (numChannels, blockSize);
+        juce::MidiBuffer midi;
+        juce::Random random (0x7a9);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            for (int i = 0; i < blockSize; ++i)
+                input.setSample (ch, i, static_cast<SampleType> (random.nextFloat() * 0.5f - 0.25f));
+
+        // Let the delay lines and reverbs fill first, so every block does the full work
+        for (int i = 0; i < static_cast<int> (sampleRate) / blockSize; ++i)
+        {
+            buffer.makeCopyOf (input, true);
+            processor.processBlock (buffer, midi);
+        }
+
+        const double ms = Benchmark::meanMilliseconds (timedBlocks, [&]
+        {
+            buffer.makeCopyOf (input, true);
+            processor.processBlock (buffer, midi);
+        });
+
+        processor.releaseResources();
+        return ms;
+    }
+};
+
+static ProcessingPrecisionBenchmark processingPrecisionBenchmark;
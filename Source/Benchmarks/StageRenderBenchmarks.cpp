@@ -0,0 +1,100 @@
+#include "../PluginProcessor.h"
+#include "../SurroundStageView.h"
+#include "BenchmarkTimer.h"
+#include <cstdlib>
+
+//==============================================================================
+/**
+ * Software fallback of the surround stage: paint time at fixed sizes and camera
+ * angles, as reported by the view itself (getLastSoftwareRenderMs)
+ */
+class StageRenderBenchmark : public juce::UnitTest
+{
+public:
+    StageRenderBenchmark() : juce::UnitTest ("Stage software render", "Benchmarks") {}
+
+    void runTest() override
+    {
+        static constexpr int timedPaints = 200;
+
+        // The view picks its renderer on construction
+       #if JUCE_WINDOWS
+        _putenv_s ("TAPMATRIX_SOFTWARE_3D", "1");
+       #else
+        setenv ("TAPMATRIX_SOFTWARE_3D", "1", 1);
+       #endif
+
+        TapMatrixAudioProcessor processor;
+        processor.setCurrentProgram (4);
+
+        SurroundStageView view;
+        view.setTapSource (processor.getParameters(), [] (int) { return 0.5f; });
+        view.updateTaps (1.0 / 60.0);
+
+        beginTest ("Software render at fixed sizes and angles");
+        {
+            expect (view.isUsingSoftwareRenderer());
+
+            for (auto size : { juce::Point<int> (320, 240), juce::Point<int> (640, 480), juce::Point<int> (1280, 960) })
+            {
+                view.setSize (size.x, size.y);
+                juce::Image image (juce::Image::ARGB, size.x, size.y, true);
+
+                for (const auto& camera : cameras)
+                {
+                    view.setAzimuth (camera.azimuth);
+                    view.setElevation (camera.elevation);
+
+                    // Fixed camera: the projected scene is cached, only the tap markers are projected
+                    const double cachedMs = meanRenderMilliseconds (view, image, timedPaints, [] (int) {});
+
+                    // Orbiting camera: the scene is re-projected on every paint
+                    const double orbitingMs = meanRenderMilliseconds (view, image, timedPaints, [&] (int paint)
+                    {
+                        view.setAzimuth (camera.azimuth + ((paint & 1) != 0 ? 0.5f : 0.0f));
+                    });
+
+                    logMessage (juce::String (size.x) + "x" + juce::String (size.y) + " " + camera.name
+                                + ": fixed camera " + Benchmark::formatMicroseconds (cachedMs)
+                                + ", orbiting " + Benchmark::formatMicroseconds (orbitingMs));
+
+                    expect (cachedMs > 0.0 && orbitingMs > 0.0);
+                }
+            }
+        }
+    }
+
+private:
+    struct Camera
+    {
+        const char* name;
+        float azimuth, elevation;
+    };
+
+    static constexpr Camera cameras[] = { { "angle", 225.0f, 30.0f },
+                                          { "top",   0.0f,   89.0f },
+                                          { "left",  270.0f, 0.0f },
+                                          { "back",  180.0f, 10.0f } };
+
+    /** Mean of the view's own paint timings, after a few untimed warm-up paints */
+    template <typename BeforePaint>
+    static double meanRenderMilliseconds (SurroundStageView& view, juce::Image& image, int paints, BeforePaint&& beforePaint)
+    {
+        double totalMs = 0.0;
+
+        for (int paint = -Benchmark::warmUpIterations; paint < paints; ++paint)
+        {
+            beforePaint (paint);
+
+            juce::Graphics g (image);
+            view.paintEntireComponent (g, false);
+
+            if (paint >= 0)
+                totalMs += view.getLastSoftwareRenderMs();
+        }
+
+        return totalMs / juce::jmax (1, paints);
+    }
+};
+
+static StageRenderBenchmark stageRenderBenchmark;
@@ -0,0 +1,105 @@
+#include "../PluginProcessor.h"
+#include "BenchmarkTimer.h"
+#include <limits>
+
+//==============================================================================
+/**
+ * Plugin state load time: the compact binary format against the legacy XML state
+ * it replaced (still read for sessions saved by older builds)
+ */
+class StateLoadBenchmark : public juce::UnitTest
+{
+public:
+    StateLoadBenchmark() : juce::UnitTest ("State load", "Benchmarks") {}
+
+    void runTest() override
+    {
+        static constexpr int timedLoads = 500;
+
+        TapMatrixAudioProcessor processor;
+
+        // A non-default preset, so every load rewrites real values
+        processor.setCurrentProgram (4);
+
+        juce::MemoryBlock binaryState;
+        processor.getStateInformation (binaryState);
+
+        const auto xmlState = createLegacyXmlState (processor);
+        const auto parameterIDs = BinaryStateFormat::getParameterIDs (numTaps);
+        const auto savedValues = getNormalisedValues (processor, parameterIDs);
+
+        beginTest ("Binary vs XML state load");
+        {
+            const double binaryMs = Benchmark::meanMilliseconds (timedLoads, [&]
+            {
+                processor.setStateInformation (binaryState.getData(), static_cast<int> (binaryState.getSize()));
+            });
+
+            const double xmlMs = Benchmark::meanMilliseconds (timedLoads, [&]
+            {
+                processor.setStateInformation (xmlState.getData(), static_cast<int> (xmlState.getSize()));
+            });
+
+            logMessage ("State size: binary " + juce::String (static_cast<int> (binaryState.getSize())) + " bytes, XML "
+                        + juce::String (static_cast<int> (xmlState.getSize())) + " bytes");
+            logMessage ("Mean load time over " + juce::String (timedLoads) + " loads: binary "
+                        + Benchmark::formatMicroseconds (binaryMs) + ", XML " + Benchmark::formatMicroseconds (xmlMs)
+                        + " (" + juce::String (xmlMs / juce::jmax (1.0e-9, binaryMs), 1) + "x)");
+
+            expect (binaryState.getSize() < xmlState.getSize());
+        }
+
+        beginTest ("Binary state round trip");
+        {
+            TapMatrixAudioProcessor restored;
+            restored.setStateInformation (binaryState.getData(), static_cast<int> (binaryState.getSize()));
+
+            const auto restoredValues = getNormalisedValues (restored, parameterIDs);
+            for (size_t i = 0; i < savedValues.size(); ++i)
+                expectWithinAbsoluteError (restoredValues[i], savedValues[i], 1.0e-5f, parameterIDs[static_cast<int> (i)]);
+        }
+
+        beginTest ("Non-finite values fall back to defaults");
+        {
+            juce::MemoryBlock corrupt (binaryState);
+            auto* values = static_cast<unsigned char*> (corrupt.getData()) + BinaryStateFormat::currentHeaderSize;
+            BinaryStateFormat::writeFloat (values + sizeof (float) * BinaryStateFormat::tapGain,
+                                           std::numeric_limits<float>::quiet_NaN());
+            BinaryStateFormat::writeFloat (values + sizeof (float) * BinaryStateFormat::tapDelayTime,
+                                           std::numeric_limits<float>::infinity());
+
+            TapMatrixAudioProcessor restored;
+            restored.setStateInformation (corrupt.getData(), static_cast<int> (corrupt.getSize()));
+
+            for (auto index : { BinaryStateFormat::tapGain, BinaryStateFormat::tapDelayTime })
+            {
+                auto* param = restored.getParameters().getParameter (parameterIDs[index]);
+                expectEquals (param->getValue(), param->getDefaultValue());
+            }
+        }
+    }
+
+private:
+    static constexpr int numTaps = 8;  // TapMatrixAudioProcessor::NUM_TAPS
+
+    /** The state as builds before the binary format saved it */
+    static juce::MemoryBlock createLegacyXmlState (TapMatrixAudioProcessor& processor)
+    {
+        auto state = processor.getParameters().copyState();
+        state.setProperty ("uiScaleFactor", processor.getUIScaleFactor(), nullptr);
+
+        juce::MemoryBlock data;
+        juce::AudioProcessor::copyXmlToBinary (*state.createXml(), data);
+        return data;
+    }
+
+    static std::vector<float> getNormalisedValues (TapMatrixAudioProcessor& processor, const juce::StringArray& parameterIDs)
+    {
+        std::vector<float> values;
+        for (auto& id : parameterIDs)
+            values.push_back (processor.getParameters().getParameter (id)->getValue());
+        return values;
+    }
+};
+
+static StateLoadBenchmark stateLoadBenchmark;
@@ -0,0 +1,243 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <cstring>
+
+//==============================================================================
+/**
+ * Compact Binary State Format
+ *
+ * Plugin state is a small versioned header followed by one packed float per
+ * parameter, keyed by a stable parameter index (see getParameterIDs).
+ * All fields are little-endian.
+ *
+ *   offset  0: uint32 magic ("TMXS")
+ *   offset  4: uint32 version
+ *   offset  8: uint32 headerSize (bytes before the first value)
+ *   offset 12: uint32 numValues
+ *   offset 16: float  uiScaleFactor
+ *   offset headerSize: float values[numValues] (plain, denormalised)
+ *
+ * Migration rules:
+ * - The parameter ID list is APPEND ONLY, so an index always means the same parameter.
+ * - Older states (fewer values) leave newer parameters at their defaults.
+ * - Newer states (more values, larger header) are read as far as this build understands.
+ */
+namespace BinaryStateFormat
+{
+    static constexpr juce::uint32 magic = 0x53584d54;  // "TMXS"
+    static constexpr juce::uint32 currentVersion = 3;
+    static constexpr juce::uint32 currentHeaderSize = 20;
+
+    //==============================================================================
+    /** Version 1 per-tap parameter layout (tap-major, one block of these per tap) */
+    enum TapParameter
+    {
+        tapGain = 0,
+        tapDelayTime,
+        tapFeedback,
+        tapCrosstalk,
+        tapDamping,
+        tapReverb,
+        tapPanX,
+        tapPanY,
+        tapPanZ,
+        tapSyncMode,
+        tapSyncDelay,
+        numTapParameters
+    };
+
+    /** Version 1 global parameter layout (follows the per-tap blocks) */
+    enum GlobalParameter
+    {
+        globalMix = 0,
+        globalOutputGain,
+        globalHue,
+        globalReverbType,
+        globalHpfFreq,
+        globalLpfFreq,
+        globalDucking,
+        globalTapeMode,
+        globalTapeWow,
+        globalTapeFlutter,
+        globalTapeSaturation,
+        numGlobalParameters
+    };
+
+    /** Version 2 per-tap parameter layout (one block per tap, after the version 1 globals) */
+    enum TapParameterV2
+    {
+        tapInputSource = 0,
+        numTapParametersV2
+    };
+
+    /** Version 3 per-tap parameter layout (one block per tap, after the version 2 blocks) */
+    enum TapParameterV3
+    {
+        tapLfoShape = 0,
+        tapLfoRate,
+        tapLfoSync,
+        tapLfoSyncBeats,
+        tapLfoDelayDepth,
+        tapLfoPanXDepth,
+        tapLfoPanYDepth,
+        tapLfoGainDepth,
+        tapLfoReverbDepth,
+        numTapParametersV3
+    };
+
+    static constexpr const char* tapParameterNames[numTapParameters] =
+        { "gain", "delayTime", "feedback", "crosstalk", "damping", "reverb",
+          "panX", "panY", "panZ", "syncMode", "syncDelay" };
+
+    static constexpr const char* globalParameterNames[numGlobalParameters] =
+        { "mix", "outputGain", "hue", "reverbType", "hpfFreq", "lpfFreq", "ducking",
+          "tapeMode", "tapeWow", "tapeFlutter", "tapeSaturation" };
+
+    static constexpr const char* tapParameterNamesV2[numTapParametersV2] =
+        { "inputSource" };
+
+    static constexpr const char* tapParameterNamesV3[numTapParametersV3] =
+        { "lfoShape", "lfoRate", "lfoSync", "lfoSyncBeats", "lfoDelayDepth",
+          "lfoPanXDepth", "lfoPanYDepth", "lfoGainDepth", "lfoReverbDepth" };
+
+    /** Index of a global parameter in the stable order */
+    constexpr int getGlobalIndex (int numTaps, GlobalParameter param)
+    {
+        return numTaps * numTapParameters + param;
+    }
+
+    /** Index of a version 2 per-tap parameter in the stable order */
+    constexpr int getTapV2Index (int numTaps, int tap, TapParameterV2 param)
+    {
+        return numTaps * numTapParameters + numGlobalParameters + tap * numTapParametersV2 + param;
+    }
+
+    /** Index of a version 3 per-tap parameter in the stable order */
+    constexpr int getTapV3Index (int numTaps, int tap, TapParameterV3 param)
+    {
+        return numTaps * (numTapParameters + numTapParametersV2) + numGlobalParameters
+             + tap * numTapParametersV3 + param;
+    }
+
+    /** Total number of parameters in the stable order */
+    constexpr int getNumParameters (int numTaps)
+    {
+        return numTaps * (numTapParameters + numTapParametersV2 + numTapParametersV3) + numGlobalParameters;
+    }
+
+    /** Stable parameter order - APPEND ONLY, never reorder or remove entries */
+    inline juce::StringArray getParameterIDs (int numTaps)
+    {
+        juce::StringArray ids;
+
+        // Version 1: per-tap parameters, tap-major
+        for (int tap = 0; tap < numTaps; ++tap)
+            for (auto* name : tapParameterNames)
+                ids.add (juce::String (name) + juce::String (tap + 1));
+
+        // Version 1: global parameters
+        for (auto* name : globalParameterNames)
+            ids.add (name);
+
+        // Version 2: per-tap input routing, tap-major
+        for (int tap = 0; tap < numTaps; ++tap)
+            for (auto* name : tapParameterNamesV2)
+                ids.add (juce::String (name) + juce::String (tap + 1));
+
+        // Version 3: per-tap modulation, tap-major
+        for (int tap = 0; tap < numTaps; ++tap)
+            for (auto* name : tapParameterNamesV3)
+                ids.add (juce::String (name) + juce::String (tap + 1));
+
+        return ids;
+    }
+
+    //==============================================================================
+    inline void writeUint32 (unsigned char* dest, juce::uint32 value)
+    {
+        value = juce::ByteOrder::swapIfBigEndian (value);
+        std::memcpy (dest, &value, sizeof (value));
+    }
+
+    inline void writeFloat (unsigned char* dest, float value)
+    {
+        juce::uint32 bits;
+        std::memcpy (&bits, &value, sizeof (bits));
+        writeUint32 (dest, bits);
+    }
+
+    inline juce::uint32 readUint32 (const unsigned char* src)
+    {
+        return juce::ByteOrder::littleEndianInt (src);
+    }
+
+    inline float readFloat (const unsigned char* src)
+    {
+        const juce::uint32 bits = readUint32 (src);
+        float value;
+        std::memcpy (&value, &bits, sizeof (value));
+        return value;
+    }
+
+    //==============================================================================
+    /** Write a state; getValue (index) returns the plain value of each parameter */
+    template <typename ValueGetter>
+    void write (juce::MemoryBlock& dest, int numValues, float uiScaleFactor, ValueGetter&& getValue)
+    {
+        dest.setSize (currentHeaderSize + sizeof (float) * static_cast<size_t> (numValues));
+        auto* bytes = static_cast<unsigned char*> (dest.getData());
+
+        writeUint32 (bytes, magic);
+        writeUint32 (bytes + 4, currentVersion);
+        writeUint32 (bytes + 8, currentHeaderSize);
+        writeUint32 (bytes + 12, static_cast<juce::uint32> (numValues));
+        writeFloat (bytes + 16, uiScaleFactor);
+
+        auto* values = bytes + currentHeaderSize;
+        for (int i = 0; i < numValues; ++i)
+            writeFloat (values + sizeof (float) * static_cast<size_t> (i), getValue (i));
+    }
+
+    //==============================================================================
+    /** Non-owning view of a parsed state (points into the host's data) */
+    struct ParsedState
+    {
+        juce::uint32 version = 0;
+        float uiScaleFactor = 1.0f;
+        int numValues = 0;
+        const unsigned char* values = nullptr;
+
+        float getValue (int index) const
+        {
+            return readFloat (values + sizeof (float) * static_cast<size_t> (index));
+        }
+    };
+
+    /** Returns false if the data is not a (complete) binary state */
+    inline bool parse (const void* data, int sizeInBytes, ParsedState& result)
+    {
+        if (data == nullptr || sizeInBytes < static_cast<int> (currentHeaderSize))
+            return false;
+
+        const auto* bytes = static_cast<const unsigned char*> (data);
+
+        if (readUint32 (bytes) != magic)
+            return false;
+
+        const auto headerSize = readUint32 (bytes + 8);
+        const auto numValues = readUint32 (bytes + 12);
+
+        // Header may grow in later versions, but never shrink below version 1
+        if (headerSize < currentHeaderSize
+            || static_cast<juce::uint64> (headerSize) + sizeof (float) * static_cast<juce::uint64> (numValues)
+                   > static_cast<juce::uint64> (sizeInBytes))
+            return false;
+
+        result.version = readUint32 (bytes + 4);
+        result.uiScaleFactor = readFloat (bytes + 16);
+        result.numValues = static_cast<int> (numValues);
+        result.values = bytes + headerSize;
+        return true;
+    }
+}
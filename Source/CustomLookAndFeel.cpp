@@ -1,7 +1,9 @@
 #include "CustomLookAndFeel.h"
 #include "SliderModule.h"
 #include "ColorPalette.h"
+#include "EmbeddedAssets.h"
 #include "SyncNoteValue.h"  // For note value helpers
+#include "TextLayoutCache.h"
 
 CustomLookAndFeel::CustomLookAndFeel()
 {
@@ -19,14 +21,8 @@ void CustomLookAndFeel::ensureSVGsLoadedForStyle (FaderStyle style)
     if (trackDrawables.find (style) != trackDrawables.end())
         return;
     
-    auto assetsPath = juce::File (SliderModule::getAssetsBasePath());
     auto styleInfo = SliderModule::getStyleInfo (style);
-    auto stylePath = assetsPath.getChildFile (styleInfo.folderName);
-    
-    auto trackFile = stylePath.getChildFile (styleInfo.folderName + "_frame.svg");
-    
-    if (trackFile.existsAsFile())
-        trackDrawables[style] = juce::Drawable::createFromSVGFile (trackFile);
+    trackDrawables[style] = EmbeddedAssets::getDrawable (styleInfo.folderName + "_frame.svg");
 }
 
 void CustomLookAndFeel::setSliderTrackImage (const juce::Image& trackImage)
@@ -86,11 +82,11 @@ void CustomLookAndFeel::drawLinearSlider (juce::Graphics& g,
     const_cast<CustomLookAndFeel*>(this)->ensureSVGsLoadedForStyle (faderStyle);
     
     // Get the track SVG drawable for this style (thumb is rendered by spritesheet)
-    juce::Drawable* trackDrawable = nullptr;
+    const juce::Drawable* trackDrawable = nullptr;
     
     auto trackIt = trackDrawables.find (faderStyle);
     if (trackIt != trackDrawables.end())
-        trackDrawable = trackIt->second.get();
+        trackDrawable = trackIt->second;
     
     if (isHorizontal)
     {
@@ -168,8 +164,8 @@ void CustomLookAndFeel::drawLinearSlider (juce::Graphics& g,
                     float fontSize = SliderModule::baseValueFontSize * scaleFactor;  // Default
                     if (auto* sm = dynamic_cast<SliderModule*>(slider.getParentComponent()))
                         fontSize = sm->valueFontSize();
-                    g.setFont (juce::FontOptions (fontSize, juce::Font::plain));
-                    g.drawText (dirLabel, centerBounds, juce::Justification::centred, false);
+                    TextLayoutCache::getInstance()->drawText (g, dirLabel, fontSize, juce::Font::plain,
+                                                             centerBounds, juce::Justification::centred);
                 }
                 else
                 {
@@ -181,12 +177,12 @@ void CustomLookAndFeel::drawLinearSlider (juce::Graphics& g,
                     
                     // Draw direction label (L/R) on top at thumb position
                     auto dirBounds = juce::Rectangle<float> (thumbX, startY, thumbWidth, lineHeight);
-                    g.setFont (juce::FontOptions (smallFontSize, juce::Font::bold));
-                    g.drawText (dirLabel, dirBounds, juce::Justification::centred, false);
+                    auto& textCache = *TextLayoutCache::getInstance();
+                    textCache.drawText (g, dirLabel, smallFontSize, juce::Font::bold, dirBounds, juce::Justification::centred);
                     
                     // Draw value directly below with no gap
                     auto valBounds = juce::Rectangle<float> (thumbX, startY + lineHeight, thumbWidth, lineHeight);
-                    g.drawText (valueText, valBounds, juce::Justification::centred, false);
+                    textCache.drawText (g, valueText, smallFontSize, juce::Font::bold, valBounds, juce::Justification::centred);
                 }
             }
             else
@@ -210,8 +206,8 @@ void CustomLookAndFeel::drawLinearSlider (juce::Graphics& g,
                 float fontSize = SliderModule::baseValueFontSize * scaleFactor;  // Default
                 if (auto* sm = dynamic_cast<SliderModule*>(slider.getParentComponent()))
                     fontSize = sm->valueFontSize();
-                g.setFont (juce::FontOptions (fontSize, juce::Font::plain));
-                g.drawText (valueText, textBounds, juce::Justification::centred, false);
+                TextLayoutCache::getInstance()->drawText (g, valueText, fontSize, juce::Font::plain,
+                                                         textBounds, juce::Justification::centred);
             }
         }
     }
@@ -332,8 +328,8 @@ void CustomLookAndFeel::drawLinearSlider (juce::Graphics& g,
             textBounds = textBounds.translated (0.0f, descenderOffset);
             
             g.setColour (textColour);
-            g.setFont (juce::FontOptions (valueFontSize, juce::Font::plain));
-            g.drawText (valueText, textBounds, juce::Justification::centred, false);
+            TextLayoutCache::getInstance()->drawText (g, valueText, valueFontSize, juce::Font::plain,
+                                                     textBounds, juce::Justification::centred);
         }
     }
 }
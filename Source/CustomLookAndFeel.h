@@ -42,7 +42,7 @@ private:
     juce::Image knobImage;
     
     // Per-style SVG caches (track frame only - thumb is rendered by spritesheet)
-    std::map<FaderStyle, std::unique_ptr<juce::Drawable>> trackDrawables;
+    std::map<FaderStyle, const juce::Drawable*> trackDrawables;  // Shared, owned by EmbeddedAssets
     
     // Load SVGs for a specific style (lazy loading)
     void ensureSVGsLoadedForStyle (FaderStyle style);
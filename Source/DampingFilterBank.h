@@ -0,0 +1,70 @@
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include <array>
+#include <cmath>
+
+//==============================================================================
+/**
+ * Damping Filter Bank
+ *
+ * One-pole low-pass filters for the feedback loop of every tap (spec §8.3),
+ * stored structure-of-arrays so all taps update in one SIMD step per sample.
+ *
+ *     y[n] = y[n-1] + a * (x[n] - y[n-1])
+ *
+ * Coefficients are computed once per block. Damping 0% gives a = 1 (exact bypass).
+ */
+template <int NumFilters>
+struct DampingFilterBank
+{
+    // Damping 100% darkens repeats down to this cutoff
+    static constexpr float minCutoffHz = 500.0f;
+    static constexpr float maxCutoffHz = 20000.0f;
+
+    alignas (32) std::array<float, NumFilters> coeffs {};
+    alignas (32) std::array<float, NumFilters> states {};
+
+    void reset()
+    {
+        states.fill (0.0f);
+    }
+
+    /** Set one filter's coefficient from a 0-1 damping amount (call at block rate) */
+    void setDamping (int index, float damping, double sampleRate)
+    {
+        if (damping < 0.001f)
+        {
+            coeffs[index] = 1.0f;
+            return;
+        }
+
+        const float maxCutoff = juce::jmin (maxCutoffHz, static_cast<float> (sampleRate) * 0.45f);
+        const float cutoff = maxCutoff * std::pow (minCutoffHz / maxCutoff, damping);
+        coeffs[index] = 1.0f - std::exp (-juce::MathConstants<float>::twoPi * cutoff / static_cast<float> (sampleRate));
+    }
+
+    /** Filter one sample for every tap in place (samples must be SIMD-aligned) */
+    void process (float* samples) noexcept
+    {
+       #if JUCE_USE_SIMD
+        using Vec = juce::dsp::SIMDRegister<float>;
+        static_assert (NumFilters % Vec::SIMDNumElements == 0, "Filter count must fill whole SIMD registers");
+
+        for (int i = 0; i < NumFilters; i += static_cast<int> (Vec::SIMDNumElements))
+        {
+            auto x = Vec::fromRawArray (samples + i);
+            auto y = Vec::fromRawArray (states.data() + i);
+            y = y + Vec::fromRawArray (coeffs.data() + i) * (x - y);
+            y.copyToRawArray (states.data() + i);
+            y.copyToRawArray (samples + i);
+        }
+       #else
+        for (int i = 0; i < NumFilters; ++i)
+        {
+            states[i] += coeffs[i] * (samples[i] - states[i]);
+            samples[i] = states[i];
+        }
+       #endif
+    }
+};
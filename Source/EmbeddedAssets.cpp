@@ -0,0 +1,61 @@
+#include "EmbeddedAssets.h"
+#include <BinaryData.h>
+#include <map>
+#include <memory>
+
+namespace
+{
+    /** Parsed SVGs, released with the other GUI singletons when JUCE shuts down */
+    class DrawableCache : public juce::DeletedAtShutdown
+    {
+    public:
+        ~DrawableCache() override { clearSingletonInstance(); }
+
+        // Failed lookups are kept too (as nullptr) so they are only attempted once
+        std::map<juce::String, std::unique_ptr<juce::Drawable>> drawables;
+
+        JUCE_DECLARE_SINGLETON (DrawableCache, false)
+    };
+
+    JUCE_IMPLEMENT_SINGLETON (DrawableCache)
+}
+
+const void* EmbeddedAssets::getData (const juce::String& fileName, int& sizeInBytes)
+{
+    sizeInBytes = 0;
+
+    // Resource names are mangled file names; match on the original name instead
+    for (int i = 0; i < BinaryData::namedResourceListSize; ++i)
+        if (fileName == BinaryData::originalFilenames[i])
+            return BinaryData::getNamedResource (BinaryData::namedResourceList[i], sizeInBytes);
+
+    return nullptr;
+}
+
+juce::Image EmbeddedAssets::loadImage (const juce::String& fileName)
+{
+    int size = 0;
+    if (const auto* data = getData (fileName, size))
+        return juce::ImageFileFormat::loadFrom (data, static_cast<size_t> (size));
+
+    DBG ("ERROR: Embedded image not found: " + fileName);
+    return {};
+}
+
+const juce::Drawable* EmbeddedAssets::getDrawable (const juce::String& fileName)
+{
+    auto& drawables = DrawableCache::getInstance()->drawables;
+
+    if (auto found = drawables.find (fileName); found != drawables.end())
+        return found->second.get();
+
+    std::unique_ptr<juce::Drawable> drawable;
+
+    int size = 0;
+    if (const auto* data = getData (fileName, size))
+        drawable = juce::Drawable::createFromImageData (data, static_cast<size_t> (size));
+    else
+        DBG ("ERROR: Embedded SVG not found: " + fileName);
+
+    return (drawables[fileName] = std::move (drawable)).get();
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+
+/**
+ * Access to the assets compiled into the plugin binary (see the TapMatrixAssets
+ * binary data target in CMakeLists.txt)
+ *
+ * Assets are looked up by their original file name, e.g.
+ * "Fader 38 x 170_frame.svg". Nothing is read from disk, and nothing is decoded
+ * until first asked for. Decoded SVGs are kept in one process-wide cache, so
+ * every plugin instance and editor shares the same copy.
+ *
+ * Use from the message thread only.
+ */
+namespace EmbeddedAssets
+{
+    /** Raw bytes of an embedded asset, or nullptr (and size 0) if there is no such asset */
+    const void* getData (const juce::String& fileName, int& sizeInBytes);
+
+    /**
+     * Decode an embedded image. Not cached: callers keep their own compact copy
+     * (see FaderSpriteStore) so the full decoded image can be released.
+     */
+    juce::Image loadImage (const juce::String& fileName);
+
+    /** Parsed embedded SVG, shared process-wide; nullptr if missing or invalid */
+    const juce::Drawable* getDrawable (const juce::String& fileName);
+}
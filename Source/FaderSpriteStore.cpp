@@ -0,0 +1,396 @@
+#include "FaderSpriteStore.h"
+#include <juce_dsp/juce_dsp.h>
+#include <array>
+#include <cstring>
+#include <string_view>
+
+//==============================================================================
+// TINT KERNEL
+//==============================================================================
+namespace
+{
+    /**
+     * Multiply the colour channels of premultiplied ARGB pixels by a tint, in place.
+     * Premultiplied values stay valid (never above alpha), so no unpremultiply is needed.
+     * Factors are 8.8 fixed point; 256 leaves a channel (alpha) unchanged.
+     */
+    void tintPremultipliedARGB (juce::uint8* pixels, size_t numPixels, juce::Colour tint)
+    {
+        // Channel order in memory depends on the platform's PixelARGB layout
+        std::array<juce::uint16, 4> factors;
+        {
+            const juce::PixelARGB probe (0, 1, 2, 3);  // a, r, g, b
+            juce::uint8 order[4];
+            std::memcpy (order, &probe, sizeof (order));
+
+            const juce::uint16 channelFactors[4] = { 256,
+                                                     static_cast<juce::uint16> (tint.getRed() + (tint.getRed() >> 7)),
+                                                     static_cast<juce::uint16> (tint.getGreen() + (tint.getGreen() >> 7)),
+                                                     static_cast<juce::uint16> (tint.getBlue() + (tint.getBlue() >> 7)) };
+            for (size_t i = 0; i < 4; ++i)
+                factors[i] = channelFactors[order[i]];
+        }
+
+        size_t i = 0;
+
+       #if JUCE_USE_SIMD
+        // 4 pixels per step: widen bytes to 16-bit lanes, multiply, shift, narrow
+        const size_t numBytes = numPixels * 4;
+
+        #if JUCE_INTEL
+        const auto zero = _mm_setzero_si128();
+        const auto factorVec = _mm_setr_epi16 (static_cast<short> (factors[0]), static_cast<short> (factors[1]),
+                                               static_cast<short> (factors[2]), static_cast<short> (factors[3]),
+                                               static_cast<short> (factors[0]), static_cast<short> (factors[1]),
+                                               static_cast<short> (factors[2]), static_cast<short> (factors[3]));
+
+        for (; i + 16 <= numBytes; i += 16)
+        {
+            const auto px = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (pixels + i));
+            const auto lo = _mm_srli_epi16 (_mm_mullo_epi16 (_mm_unpacklo_epi8 (px, zero), factorVec), 8);
+            const auto hi = _mm_srli_epi16 (_mm_mullo_epi16 (_mm_unpackhi_epi8 (px, zero), factorVec), 8);
+            _mm_storeu_si128 (reinterpret_cast<__m128i*> (pixels + i), _mm_packus_epi16 (lo, hi));
+        }
+        #else
+        const juce::uint16 factorLanes[8] = { factors[0], factors[1], factors[2], factors[3],
+                                              factors[0], factors[1], factors[2], factors[3] };
+        const auto factorVec = vld1q_u16 (factorLanes);
+
+        for (; i + 16 <= numBytes; i += 16)
+        {
+            const auto px = vld1q_u8 (pixels + i);
+            const auto lo = vshrq_n_u16 (vmulq_u16 (vmovl_u8 (vget_low_u8 (px)), factorVec), 8);
+            const auto hi = vshrq_n_u16 (vmulq_u16 (vmovl_u8 (vget_high_u8 (px)), factorVec), 8);
+            vst1q_u8 (pixels + i, vcombine_u8 (vmovn_u16 (lo), vmovn_u16 (hi)));
+        }
+        #endif
+
+        i /= 4;
+       #endif
+
+        for (; i < numPixels; ++i)
+        {
+            auto* pixel = pixels + i * 4;
+            for (size_t c = 0; c < 4; ++c)
+                pixel[c] = static_cast<juce::uint8> ((pixel[c] * factors[c]) >> 8);
+        }
+    }
+
+    //==========================================================================
+    /** Collects distinct pixel rows, handing out one index per distinct row */
+    class RowDictionary
+    {
+    public:
+        explicit RowDictionary (size_t bytesPerRow) : rowBytes (bytesPerRow) {}
+
+        juce::uint32 add (const juce::uint8* row)
+        {
+            const std::string_view key (reinterpret_cast<const char*> (row), rowBytes);
+            const auto hash = std::hash<std::string_view>() (key);
+
+            for (auto [it, end] = lookup.equal_range (hash); it != end; ++it)
+                if (std::memcmp (rows.data() + it->second * rowBytes, row, rowBytes) == 0)
+                    return it->second;
+
+            const auto index = static_cast<juce::uint32> (rows.size() / rowBytes);
+            rows.insert (rows.end(), row, row + rowBytes);
+            lookup.emplace (hash, index);
+            return index;
+        }
+
+        std::vector<juce::uint8> takeRows()
+        {
+            rows.shrink_to_fit();
+            return std::move (rows);
+        }
+
+    private:
+        size_t rowBytes;
+        std::vector<juce::uint8> rows;                              // Distinct rows, back to back
+        std::unordered_multimap<size_t, juce::uint32> lookup;       // Row hash -> row index
+    };
+}
+
+//==============================================================================
+// COMPACT SHEET
+//==============================================================================
+FaderSpriteStore::CompactSheet::CompactSheet (const juce::Image& sheet, int width, int height)
+    : frameWidth (width), frameHeight (height)
+{
+    jassert (sheet.getWidth() >= frameWidth && frameHeight > 0);
+
+    numFrames = sheet.getHeight() / frameHeight;
+    rowBytes = static_cast<size_t> (frameWidth) * 4;
+
+    // Rows are compared as raw premultiplied ARGB bytes
+    const auto argb = sheet.convertedToFormat (juce::Image::ARGB);
+    const juce::Image::BitmapData bitmap (argb, juce::Image::BitmapData::readOnly);
+
+    RowDictionary dictionary (rowBytes);
+    const int totalRows = numFrames * frameHeight;
+    auto indices = std::make_shared<std::vector<juce::uint32>>();
+    indices->reserve (static_cast<size_t> (totalRows));
+
+    for (int y = 0; y < totalRows; ++y)
+        indices->push_back (dictionary.add (bitmap.getLinePointer (y)));
+
+    rowIndices = std::move (indices);
+    rows = dictionary.takeRows();
+}
+
+std::unique_ptr<FaderSpriteStore::CompactSheet> FaderSpriteStore::CompactSheet::createTinted (juce::Colour tint) const
+{
+    std::unique_ptr<CompactSheet> tinted (new CompactSheet());
+    tinted->frameWidth = frameWidth;
+    tinted->frameHeight = frameHeight;
+    tinted->numFrames = numFrames;
+    tinted->rowBytes = rowBytes;
+    tinted->rowIndices = rowIndices;
+    tinted->rows = rows;
+
+    // Only the distinct rows need tinting
+    tintPremultipliedARGB (tinted->rows.data(), tinted->rows.size() / 4, tint);
+    return tinted;
+}
+
+std::unique_ptr<FaderSpriteStore::CompactSheet> FaderSpriteStore::CompactSheet::createResampled (int width, int height) const
+{
+    std::unique_ptr<CompactSheet> scaled (new CompactSheet());
+    scaled->frameWidth = width;
+    scaled->frameHeight = height;
+    scaled->numFrames = numFrames;
+    scaled->rowBytes = static_cast<size_t> (width) * 4;
+
+    // Resampled frames still share most of their rows, so they compact just as well
+    RowDictionary dictionary (scaled->rowBytes);
+    auto indices = std::make_shared<std::vector<juce::uint32>>();
+    indices->reserve (static_cast<size_t> (numFrames) * static_cast<size_t> (height));
+
+    for (int frameIndex = 0; frameIndex < numFrames; ++frameIndex)
+    {
+        const auto frame = decodeFrame (frameIndex).rescaled (width, height, juce::Graphics::highResamplingQuality);
+        const juce::Image::BitmapData bitmap (frame, juce::Image::BitmapData::readOnly);
+
+        for (int y = 0; y < height; ++y)
+            indices->push_back (dictionary.add (bitmap.getLinePointer (y)));
+    }
+
+    scaled->rowIndices = std::move (indices);
+    scaled->rows = dictionary.takeRows();
+    return scaled;
+}
+
+size_t FaderSpriteStore::CompactSheet::getMemoryBytes() const
+{
+    return rows.size() + rowIndices->size() * sizeof (juce::uint32);
+}
+
+juce::Image FaderSpriteStore::CompactSheet::decodeFrame (int frameIndex) const
+{
+    frameIndex = juce::jlimit (0, numFrames - 1, frameIndex);
+
+    juce::Image frame (juce::Image::ARGB, frameWidth, frameHeight, false);
+    juce::Image::BitmapData bitmap (frame, juce::Image::BitmapData::writeOnly);
+
+    const auto* frameRows = rowIndices->data() + static_cast<size_t> (frameIndex) * static_cast<size_t> (frameHeight);
+
+    for (int y = 0; y < frameHeight; ++y)
+        std::memcpy (bitmap.getLinePointer (y), rows.data() + frameRows[y] * rowBytes, rowBytes);
+
+    return frame;
+}
+
+//==============================================================================
+// STORE
+//==============================================================================
+JUCE_IMPLEMENT_SINGLETON (FaderSpriteStore)
+
+FaderSpriteStore::~FaderSpriteStore()
+{
+    // Join the resample thread here rather than from a static destructor at unload
+    resamplePool.removeAllJobs (true, 4000);
+    clearSingletonInstance();
+}
+
+void FaderSpriteStore::addSheet (int style, const juce::Image& sheet, int frameWidth, int frameHeight)
+{
+    if (sheet.isNull() || frameWidth <= 0 || frameHeight <= 0 || sheet.getHeight() < frameHeight)
+        return;
+
+    auto compact = std::make_unique<CompactSheet> (sheet, frameWidth, frameHeight);
+    DBG ("Fader sprite sheet compacted: " + juce::String (sheet.getWidth()) + "x" + juce::String (sheet.getHeight())
+         + " -> " + juce::String (static_cast<juce::int64> (compact->getMemoryBytes() / 1024)) + " KB");
+
+    // Replacing a style's sheet invalidates its tints, resampled sheets and cached frames
+    for (auto it = sheets.begin(); it != sheets.end();)
+        it = it->first.style == style ? sheets.erase (it) : std::next (it);
+
+    for (auto it = scaledSheets.begin(); it != scaledSheets.end();)
+    {
+        if (it->first.sheet.style == style)
+        {
+            scaledSheetBytes -= it->second.sheet->getMemoryBytes();
+            it = scaledSheets.erase (it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    for (auto it = frameCache.begin(); it != frameCache.end();)
+    {
+        if (it->key.sheet.style == style)
+        {
+            frameCacheBytes -= it->bytes;
+            frameLookup.erase (it->key);
+            it = frameCache.erase (it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    sheets[{ style, untinted }] = std::move (compact);
+}
+
+std::shared_ptr<const FaderSpriteStore::CompactSheet> FaderSpriteStore::getSheet (SheetKey key)
+{
+    if (auto found = sheets.find (key); found != sheets.end())
+        return found->second;
+
+    // First use of this colour with this style: tint the untinted sheet
+    auto base = sheets.find ({ key.style, untinted });
+    if (base == sheets.end())
+        return nullptr;
+
+    auto& tinted = sheets[key];
+    tinted = base->second->createTinted (juce::Colour (key.tint));
+    return tinted;
+}
+
+juce::Image FaderSpriteStore::getFrame (SheetKey key, int frameIndex, int width, int height)
+{
+    const auto sheetPtr = getSheet (key);
+    if (sheetPtr == nullptr)
+        return {};
+
+    const auto& sheet = *sheetPtr;
+
+    // Frames are only ever scaled down from the stored resolution
+    width = juce::jlimit (1, sheet.getFrameWidth(), width);
+    height = juce::jlimit (1, sheet.getFrameHeight(), height);
+    frameIndex = juce::jlimit (0, sheet.getNumFrames() - 1, frameIndex);
+
+    const FrameKey frameKey { key, frameIndex, width, height };
+
+    if (auto found = frameLookup.find (frameKey); found != frameLookup.end())
+    {
+        frameCache.splice (frameCache.begin(), frameCache, found->second);
+        return found->second->image;
+    }
+
+    juce::Image image;
+
+    if (auto scaled = scaledSheets.find ({ key, width, height }); scaled != scaledSheets.end())
+    {
+        scaled->second.lastUsed = ++useCounter;
+        image = scaled->second.sheet->decodeFrame (frameIndex);  // Already at this size
+    }
+    else
+    {
+        image = sheet.decodeFrame (frameIndex);
+        if (width != image.getWidth() || height != image.getHeight())
+        {
+            image = image.rescaled (width, height, juce::Graphics::highResamplingQuality);
+            
+            // No resampled sheet for this size (never requested, or evicted): build one
+            prepareScaledFrames (key, width, height);
+        }
+    }
+
+    const size_t bytes = static_cast<size_t> (width) * static_cast<size_t> (height) * 4;
+    frameCache.push_front ({ frameKey, image, bytes });
+    frameLookup[frameKey] = frameCache.begin();
+    frameCacheBytes += bytes;
+
+    trimFrameCache();
+    return image;
+}
+
+void FaderSpriteStore::prepareScaledFrames (SheetKey key, int width, int height)
+{
+    auto source = getSheet (key);
+    if (source == nullptr)
+        return;
+
+    width = juce::jlimit (1, source->getFrameWidth(), width);
+    height = juce::jlimit (1, source->getFrameHeight(), height);
+
+    // Frames at the stored size need no resampling
+    if (width == source->getFrameWidth() && height == source->getFrameHeight())
+        return;
+
+    const ScaledSheetKey scaledKey { key, width, height };
+    if (scaledSheets.count (scaledKey) > 0 || !pendingScaledSheets.insert (scaledKey).second)
+        return;
+
+    resamplePool.addJob ([source, scaledKey]
+    {
+        std::shared_ptr<const CompactSheet> scaled = source->createResampled (scaledKey.width, scaledKey.height);
+
+        // The store may have been deleted at shutdown by the time this is delivered
+        juce::MessageManager::callAsync ([scaledKey, source, scaled]
+        {
+            if (auto* store = getInstanceWithoutCreating())
+                store->installScaledSheet (scaledKey, source.get(), scaled);
+        });
+    });
+}
+
+void FaderSpriteStore::installScaledSheet (ScaledSheetKey key, const CompactSheet* source,
+                                          std::shared_ptr<const CompactSheet> scaled)
+{
+    pendingScaledSheets.erase (key);
+
+    // Built from a sheet that has since been replaced
+    auto current = sheets.find (key.sheet);
+    if (current == sheets.end() || current->second.get() != source)
+        return;
+
+    scaledSheetBytes += scaled->getMemoryBytes();
+    scaledSheets[key] = { std::move (scaled), ++useCounter };
+    trimScaledSheets (key);
+}
+
+void FaderSpriteStore::trimScaledSheets (const ScaledSheetKey& keep)
+{
+    // Evict the least recently drawn sizes, never the one just built
+    while (scaledSheetBytes > scaledSheetBudgetBytes && scaledSheets.size() > 1)
+    {
+        auto oldest = scaledSheets.end();
+
+        for (auto it = scaledSheets.begin(); it != scaledSheets.end(); ++it)
+        {
+            const bool isKept = !(it->first < keep) && !(keep < it->first);
+            if (!isKept && (oldest == scaledSheets.end() || it->second.lastUsed < oldest->second.lastUsed))
+                oldest = it;
+        }
+
+        scaledSheetBytes -= oldest->second.sheet->getMemoryBytes();
+        scaledSheets.erase (oldest);
+    }
+}
+
+void FaderSpriteStore::trimFrameCache()
+{
+    // Always keep the frame just added, however large
+    while (frameCacheBytes > frameCacheBudgetBytes && frameCache.size() > 1)
+    {
+        auto& oldest = frameCache.back();
+        frameCacheBytes -= oldest.bytes;
+        frameLookup.erase (oldest.key);
+        frameCache.pop_back();
+    }
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <juce_graphics/juce_graphics.h>
+#include <juce_events/juce_events.h>
+#include <list>
+#include <map>
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Compact fader sprite storage, shared by every SliderModule in the process
+ *
+ * A fader sprite sheet is a tall strip of frames that differ only where the
+ * fill edge and thumb sit, so nearly every pixel row repeats many times. Each
+ * sheet is stored as a dictionary of distinct rows plus one row index per
+ * frame row (lossless; a 152x115,600 sheet drops from ~70 MB decoded to well
+ * under 1 MB).
+ *
+ * Colour variants are made in memory the first time a (style, colour) pair is
+ * drawn: only the distinct rows are tinted (premultiplied ARGB multiply, SIMD
+ * where available) and the row indices are shared with the untinted sheet.
+ *
+ * Frames are decoded on demand at the pixel size they are drawn at and kept
+ * in a small least-recently-used cache with a fixed memory budget, so the
+ * cache is keyed by (style, colour, size).
+ *
+ * For each size faders are drawn at, prepareScaledFrames() builds a second
+ * compact sheet with every frame already resampled to that size, on a
+ * background thread. Once it is ready a frame decode is a row copy and paint
+ * is a 1:1 blit; until then frames are resampled individually on demand (and
+ * a missing size is queued again). Resampled sheets are kept for every size
+ * in use, least recently used first out beyond a memory budget, so editors at
+ * different scales don't evict each other.
+ *
+ * Released with the other GUI singletons at shutdown (the resample thread is
+ * stopped first).
+ *
+ * Not thread-safe: use from the message thread only (the background builds
+ * only read immutable sheets and hand their result back to the message thread).
+ */
+class FaderSpriteStore : public juce::DeletedAtShutdown
+{
+public:
+    //==========================================================================
+    /** Identifies one stored sheet: fader style and tint colour (ARGB, opaque white = untinted) */
+    struct SheetKey
+    {
+        int style = 0;
+        juce::uint32 tint = 0xffffffff;
+
+        bool operator< (const SheetKey& other) const
+        {
+            return style != other.style ? style < other.style : tint < other.tint;
+        }
+    };
+
+    static constexpr juce::uint32 untinted = 0xffffffff;
+
+    //==========================================================================
+    /** One sprite sheet as distinct pixel rows plus a row index per frame row */
+    class CompactSheet
+    {
+    public:
+        CompactSheet (const juce::Image& sheet, int frameWidth, int frameHeight);
+
+        /** Copy with every pixel's colour channels multiplied by the tint (alpha kept) */
+        std::unique_ptr<CompactSheet> createTinted (juce::Colour tint) const;
+
+        int getNumFrames() const { return numFrames; }
+        int getFrameWidth() const { return frameWidth; }
+        int getFrameHeight() const { return frameHeight; }
+        size_t getMemoryBytes() const;
+
+        /** Copy with every frame resampled to width x height (slow: use off the message thread) */
+        std::unique_ptr<CompactSheet> createResampled (int width, int height) const;
+
+        /** Rebuild one frame at its stored size */
+        juce::Image decodeFrame (int frameIndex) const;
+
+    private:
+        CompactSheet() = default;
+
+        int frameWidth = 0;
+        int frameHeight = 0;
+        int numFrames = 0;
+        size_t rowBytes = 0;
+
+        std::vector<juce::uint8> rows;                               // Distinct ARGB rows, back to back
+        std::shared_ptr<const std::vector<juce::uint32>> rowIndices; // frameHeight entries per frame (shared by tints)
+
+        JUCE_DECLARE_NON_COPYABLE (CompactSheet)
+    };
+
+    //==========================================================================
+    ~FaderSpriteStore() override;
+
+    JUCE_DECLARE_SINGLETON (FaderSpriteStore, false)
+
+    /** Compact and keep a style's decoded (untinted) sheet; the caller can release the full image */
+    void addSheet (int style, const juce::Image& sheet, int frameWidth, int frameHeight);
+
+    bool hasSheet (int style) const { return sheets.find ({ style, untinted }) != sheets.end(); }
+
+    /**
+     * One frame of a style, tinted and resampled to width x height pixels (never
+     * above its stored size). Returns a null image if the style isn't loaded.
+     */
+    juce::Image getFrame (SheetKey key, int frameIndex, int width, int height);
+
+    /**
+     * Start building pre-resampled frames of a sheet at width x height in the
+     * background, unless they exist or are already being built. Frames at other
+     * sizes are kept alongside; the least recently drawn sizes are evicted once
+     * all scaled sheets exceed their memory budget.
+     */
+    void prepareScaledFrames (SheetKey key, int width, int height);
+
+private:
+    //==========================================================================
+    static constexpr size_t frameCacheBudgetBytes = 16 * 1024 * 1024;
+    static constexpr size_t scaledSheetBudgetBytes = 32 * 1024 * 1024;
+
+    struct FrameKey
+    {
+        SheetKey sheet;
+        int frameIndex;
+        int width;
+        int height;
+
+        bool operator< (const FrameKey& other) const
+        {
+            if (sheet < other.sheet) return true;
+            if (other.sheet < sheet) return false;
+            if (frameIndex != other.frameIndex) return frameIndex < other.frameIndex;
+            if (width != other.width) return width < other.width;
+            return height < other.height;
+        }
+    };
+
+    struct ScaledSheetKey
+    {
+        SheetKey sheet;
+        int width;
+        int height;
+
+        bool operator< (const ScaledSheetKey& other) const
+        {
+            if (sheet < other.sheet) return true;
+            if (other.sheet < sheet) return false;
+            if (width != other.width) return width < other.width;
+            return height < other.height;
+        }
+    };
+
+    struct CachedFrame
+    {
+        FrameKey key;
+        juce::Image image;
+        size_t bytes;
+    };
+
+    std::map<SheetKey, std::shared_ptr<const CompactSheet>> sheets;
+
+    struct ScaledSheet
+    {
+        std::shared_ptr<const CompactSheet> sheet;
+        juce::uint64 lastUsed;  // useCounter value when last drawn from
+    };
+
+    // Pre-resampled sheets (any number of sizes per sheet) and the sizes still being built
+    std::map<ScaledSheetKey, ScaledSheet> scaledSheets;
+    std::set<ScaledSheetKey> pendingScaledSheets;
+    size_t scaledSheetBytes = 0;
+    juce::uint64 useCounter = 0;
+    juce::ThreadPool resamplePool { 1 };
+
+    // Most recently used at the front
+    std::list<CachedFrame> frameCache;
+    std::map<FrameKey, std::list<CachedFrame>::iterator> frameLookup;
+    size_t frameCacheBytes = 0;
+
+    FaderSpriteStore() = default;
+    std::shared_ptr<const CompactSheet> getSheet (SheetKey key);  // Tints on first use
+    void installScaledSheet (ScaledSheetKey key, const CompactSheet* source, std::shared_ptr<const CompactSheet> scaled);
+    void trimFrameCache();
+    void trimScaledSheets (const ScaledSheetKey& keep);
+
+    JUCE_DECLARE_NON_COPYABLE (FaderSpriteStore)
+};
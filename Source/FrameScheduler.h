@@ -0,0 +1,92 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+
+//==============================================================================
+/**
+ * Editor Frame Scheduler
+ *
+ * One display-synced callback per editor replaces per-component timers. Each
+ * frame the editor advances its animations and polls the processor (meters,
+ * parameters, status) once. Components repaint only when something they show
+ * has visibly changed, so an idle editor costs a few comparisons per frame and
+ * no painting at all.
+ *
+ * Animations receive the elapsed time rather than assuming a frame rate, so
+ * they run at the same speed on 60 Hz and 120 Hz displays.
+ */
+class FrameScheduler
+{
+public:
+    /** Called once per display frame with the seconds elapsed since the previous frame */
+    using FrameCallback = std::function<void (double elapsedSeconds)>;
+
+    FrameScheduler (juce::Component& editor, FrameCallback callback)
+        : onFrame (std::move (callback)),
+          vBlankAttachment (&editor, [this] (double timestampSec) { handleVBlank (timestampSec); })
+    {
+    }
+
+    /** Frame-rate independent form of "move this fraction of the way per 60 Hz frame" */
+    static float getEasingAmount (float amountPerFrame, double elapsedSeconds)
+    {
+        return 1.0f - std::pow (1.0f - amountPerFrame, static_cast<float> (elapsedSeconds * referenceFrameRate));
+    }
+
+    /** Frame-rate independent form of "advance this much per 60 Hz frame" */
+    static float getFrameSteps (double elapsedSeconds)
+    {
+        return static_cast<float> (elapsedSeconds * referenceFrameRate);
+    }
+
+private:
+    static constexpr double referenceFrameRate = 60.0;  // Animation constants are tuned per 60 Hz frame
+    static constexpr double maxFrameSeconds = 0.1;      // Don't jump after a stall or a hidden window
+
+    FrameCallback onFrame;
+    double lastTimestamp = -1.0;
+    juce::VBlankAttachment vBlankAttachment;
+
+    void handleVBlank (double timestampSec)
+    {
+        const double elapsed = lastTimestamp < 0.0 ? 1.0 / referenceFrameRate
+                                                   : juce::jlimit (0.0, maxFrameSeconds, timestampSec - lastTimestamp);
+        lastTimestamp = timestampSec;
+        onFrame (elapsed);
+    }
+
+    JUCE_DECLARE_NON_COPYABLE (FrameScheduler)
+};
+
+//==============================================================================
+/**
+ * A displayed value that reports a change only once it has moved visibly.
+ * Poll it every frame; repaint its component only when update() returns true.
+ */
+template <typename ValueType>
+class VisualValue
+{
+public:
+    explicit VisualValue (ValueType visualThreshold) : threshold (visualThreshold) {}
+
+    /** Returns true (and takes the new value) if it differs visibly from what is displayed */
+    bool update (ValueType newValue)
+    {
+        if (hasValue && std::abs (newValue - displayed) <= threshold)
+            return false;
+
+        displayed = newValue;
+        hasValue = true;
+        return true;
+    }
+
+    ValueType get() const { return displayed; }
+
+private:
+    ValueType threshold;
+    ValueType displayed {};
+    bool hasValue = false;
+};
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include <array>
+#include <type_traits>
+
+//==============================================================================
+/**
+ * Input Routing Matrix
+ *
+ * Each tap reads one input source: the mono sum of all inputs (the classic
+ * behaviour), a single input channel, or a channel pair. A source is one row
+ * of a small (sources x input channels) weight matrix.
+ *
+ * Sources are rendered once per sub-block and shared by every tap that reads
+ * them. Only sources in use are rendered, and each uses vectorised
+ * multiply-adds over the non-zero weights of its row. Input channels the host
+ * does not provide are silent.
+ *
+ * Sources are rendered at the processing precision (float or double), and only
+ * the precision in use is allocated.
+ */
+class InputRouter
+{
+public:
+    //==========================================================================
+    static constexpr int maxInputChannels = 8;  // Up to 7.1
+
+    enum Source
+    {
+        monoSum = 0,
+        input1, input2, input3, input4, input5, input6, input7, input8,
+        inputs12, inputs34, inputs56, inputs78,
+        numSources
+    };
+
+    /** Display names, in Source order (parameter choices) */
+    static juce::StringArray getSourceNames()
+    {
+        return { "Mono Sum",
+                 "Input 1", "Input 2", "Input 3", "Input 4", "Input 5", "Input 6", "Input 7", "Input 8",
+                 "Inputs 1+2", "Inputs 3+4", "Inputs 5+6", "Inputs 7+8" };
+    }
+
+    /** Source index from a (plain) parameter value */
+    static int toSource (float value)
+    {
+        return juce::jlimit (0, numSources - 1, static_cast<int> (value + 0.5f));
+    }
+
+    //==========================================================================
+    void prepare (int maxBlockSize, bool doublePrecision)
+    {
+        floatSources.setSize (numSources, doublePrecision ? 0 : maxBlockSize);
+        doubleSources.setSize (numSources, doublePrecision ? maxBlockSize : 0);
+        floatSources.clear();
+        doubleSources.clear();
+        numMatrixInputs = -1;
+    }
+
+    /** Sources to render from now on (bit per Source; call at control rate) */
+    void setActiveSources (juce::uint32 sourceMask) noexcept { activeSources = sourceMask; }
+
+    /** Render the active sources from the input channels, scaled by gain */
+    template <typename SampleType>
+    void process (const juce::AudioBuffer<SampleType>& input, int numInputChannels, float gain, int numSamples)
+    {
+        numInputChannels = juce::jlimit (0, juce::jmin (maxInputChannels, input.getNumChannels()), numInputChannels);
+
+        // The mono sum row depends on the channel count, so the matrix only changes with the layout
+        if (numInputChannels != numMatrixInputs)
+            updateMatrix (numInputChannels);
+
+        auto& sources = getSources<SampleType>();
+
+        for (int source = 0; source < numSources; ++source)
+        {
+            if ((activeSources & (1u << source)) == 0)
+                continue;
+
+            auto* dest = sources.getWritePointer (source);
+            juce::FloatVectorOperations::clear (dest, numSamples);
+
+            for (int ch = 0; ch < numInputChannels; ++ch)
+            {
+                const float weight = matrix[static_cast<size_t> (source)][static_cast<size_t> (ch)] * gain;
+                if (weight == 0.0f)
+                    continue;
+
+                juce::FloatVectorOperations::addWithMultiply (dest, input.getReadPointer (ch),
+                                                              static_cast<SampleType> (weight), numSamples);
+            }
+        }
+    }
+
+    /** A rendered source, at the precision it was rendered in */
+    template <typename SampleType>
+    const SampleType* getSource (int source) const noexcept
+    {
+        if constexpr (std::is_same_v<SampleType, double>)
+            return doubleSources.getReadPointer (source);
+        else
+            return floatSources.getReadPointer (source);
+    }
+
+private:
+    //==========================================================================
+    std::array<std::array<float, maxInputChannels>, numSources> matrix {};
+    int numMatrixInputs = -1;
+    juce::uint32 activeSources = 1u << monoSum;
+    juce::AudioBuffer<float> floatSources;
+    juce::AudioBuffer<double> doubleSources;
+
+    template <typename SampleType>
+    juce::AudioBuffer<SampleType>& getSources() noexcept
+    {
+        if constexpr (std::is_same_v<SampleType, double>)
+            return doubleSources;
+        else
+            return floatSources;
+    }
+
+    void updateMatrix (int numInputChannels) noexcept
+    {
+        for (auto& row : matrix)
+            row.fill (0.0f);
+
+        for (int ch = 0; ch < numInputChannels; ++ch)
+        {
+            matrix[monoSum][static_cast<size_t> (ch)] = 1.0f / static_cast<float> (numInputChannels);
+            matrix[static_cast<size_t> (input1 + ch)][static_cast<size_t> (ch)] = 1.0f;
+            matrix[static_cast<size_t> (inputs12 + ch / 2)][static_cast<size_t> (ch)] = 0.5f;
+        }
+
+        numMatrixInputs = numInputChannels;
+    }
+};
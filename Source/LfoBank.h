@@ -0,0 +1,155 @@
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include <array>
+#include <cmath>
+
+//==============================================================================
+/**
+ * LFO Bank
+ *
+ * One low-frequency oscillator per tap, stored structure-of-arrays so all
+ * outputs are evaluated in one SIMD pass per control block. Outputs are
+ * bipolar (-1 to +1); every shape starts its cycle at -1.
+ *
+ * - Sine: odd polynomial (max error ~1e-4), no std::sin
+ * - Triangle
+ * - Random: glides linearly to a new random value every cycle
+ * - S&H: holds a new random value every cycle
+ *
+ * Phases either run free (advance) or are locked to the host timeline (setPhase).
+ */
+template <int NumLfos>
+class LfoBank
+{
+public:
+    enum Shape
+    {
+        sine = 0,
+        triangle,
+        random,
+        sampleAndHold,
+        numShapes
+    };
+
+    static juce::StringArray getShapeNames()
+    {
+        return { "Sine", "Triangle", "Random", "S&H" };
+    }
+
+    //==========================================================================
+    void reset()
+    {
+        phases.fill (0.0f);
+
+        for (int i = 0; i < NumLfos; ++i)
+        {
+            next[i] = randomValue();
+            startCycle (i);
+        }
+    }
+
+    /** Select a shape (call at control rate) */
+    void setShape (int lfo, int shape) noexcept
+    {
+        shape = juce::jlimit (0, numShapes - 1, shape);
+
+        sineWeights[lfo] = shape == sine ? 1.0f : 0.0f;
+        triangleWeights[lfo] = shape == triangle ? 1.0f : 0.0f;
+        randomWeights[lfo] = shape == random ? 1.0f : 0.0f;
+        holdWeights[lfo] = shape == sampleAndHold ? 1.0f : 0.0f;
+    }
+
+    /** Free-running: advance by a phase increment in cycles */
+    void advance (int lfo, float phaseIncrement) noexcept
+    {
+        float phase = phases[lfo] + phaseIncrement;
+
+        if (phase >= 1.0f)
+        {
+            phase -= std::floor (phase);
+            startCycle (lfo);
+        }
+
+        phases[lfo] = phase;
+    }
+
+    /** Tempo-locked: jump to an absolute phase in cycles (a new cycle starts when it wraps) */
+    void setPhase (int lfo, double cycles) noexcept
+    {
+        const auto phase = static_cast<float> (cycles - std::floor (cycles));
+
+        if (phase < phases[lfo])
+            startCycle (lfo);
+
+        phases[lfo] = phase;
+    }
+
+    /** Evaluate every LFO at its current phase */
+    void process() noexcept
+    {
+        // With u = |2p - 1| and v = 2u - 1: triangle = -v, sine = -sin (pi/2 * v)
+        static constexpr float c1 = 1.5701963f, c3 = -0.6415640f, c5 = 0.0713677f;  // c1 + c3 + c5 = 1
+
+       #if JUCE_USE_SIMD
+        using Vec = juce::dsp::SIMDRegister<float>;
+        static_assert (NumLfos % Vec::SIMDNumElements == 0, "LFO count must fill whole SIMD registers");
+
+        const auto one = Vec::expand (1.0f);
+        const auto two = Vec::expand (2.0f);
+
+        for (int i = 0; i < NumLfos; i += static_cast<int> (Vec::SIMDNumElements))
+        {
+            const auto p = Vec::fromRawArray (phases.data() + i);
+            const auto v = Vec::abs (p * two - one) * two - one;
+            const auto v2 = v * v;
+            const auto s = v * (Vec::expand (c1) + v2 * (Vec::expand (c3) + v2 * Vec::expand (c5)));
+
+            const auto h = Vec::fromRawArray (held.data() + i);
+            const auto glide = h + (Vec::fromRawArray (next.data() + i) - h) * p;
+
+            const auto out = Vec::fromRawArray (holdWeights.data() + i) * h
+                           + Vec::fromRawArray (randomWeights.data() + i) * glide
+                           - Vec::fromRawArray (sineWeights.data() + i) * s
+                           - Vec::fromRawArray (triangleWeights.data() + i) * v;
+            out.copyToRawArray (outputs.data() + i);
+        }
+       #else
+        for (int i = 0; i < NumLfos; ++i)
+        {
+            const float p = phases[i];
+            const float v = std::abs (2.0f * p - 1.0f) * 2.0f - 1.0f;
+            const float v2 = v * v;
+            const float s = v * (c1 + v2 * (c3 + v2 * c5));
+            const float glide = held[i] + (next[i] - held[i]) * p;
+
+            outputs[i] = holdWeights[i] * held[i] + randomWeights[i] * glide
+                       - sineWeights[i] * s - triangleWeights[i] * v;
+        }
+       #endif
+    }
+
+    /** Outputs from the last process() call (-1 to +1) */
+    float getOutput (int lfo) const noexcept { return outputs[lfo]; }
+
+private:
+    //==========================================================================
+    alignas (32) std::array<float, NumLfos> phases {};
+    alignas (32) std::array<float, NumLfos> held {};
+    alignas (32) std::array<float, NumLfos> next {};
+    alignas (32) std::array<float, NumLfos> sineWeights {};
+    alignas (32) std::array<float, NumLfos> triangleWeights {};
+    alignas (32) std::array<float, NumLfos> randomWeights {};
+    alignas (32) std::array<float, NumLfos> holdWeights {};
+    alignas (32) std::array<float, NumLfos> outputs {};
+
+    juce::Random rng;
+
+    float randomValue() noexcept { return rng.nextFloat() * 2.0f - 1.0f; }
+
+    void startCycle (int lfo) noexcept
+    {
+        held[lfo] = next[lfo];
+        next[lfo] = randomValue();
+    }
+};
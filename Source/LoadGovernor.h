@@ -0,0 +1,130 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <atomic>
+#include <cmath>
+
+//==============================================================================
+/**
+ * CPU Load Governor
+ *
+ * Tracks the ratio of processBlock time to block duration and steps the engine
+ * down one quality level at a time while the smoothed load stays high:
+ *
+ *   1. Linear instead of cubic delay interpolation
+ *   2. Reduced reverb density: tap pairs share one reverb
+ *   3. Reverb off on inactive (muted) taps
+ *   4. Coarser control rate (parameter and pan-gain smoothing steps)
+ *
+ * Hysteresis: a level is entered when the load stays above the upper threshold
+ * for a short hold time, and left only after it has stayed below the (much
+ * lower) release threshold for several seconds.
+ */
+class LoadGovernor
+{
+public:
+    //==========================================================================
+    enum Level
+    {
+        fullQuality = 0,
+        linearInterpolation,
+        sharedReverbs,
+        inactiveTapReverbOff,
+        coarseControlRate,
+        numLevels
+    };
+
+    static const char* getLevelName (int level)
+    {
+        static constexpr const char* names[numLevels] =
+            { "Full quality", "Linear interpolation", "Shared reverbs",
+              "Reverb off on inactive taps", "Coarse control rate" };
+
+        return names[juce::jlimit (0, numLevels - 1, level)];
+    }
+
+    //==========================================================================
+    void prepare (double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+        reset();
+    }
+
+    void reset()
+    {
+        smoothedLoad = 0.0;
+        secondsAbove = 0.0;
+        secondsBelow = 0.0;
+        level = fullQuality;
+        publishedLevel = fullQuality;
+        publishedLoad = 0.0f;
+    }
+
+    /** Audio thread: one processBlock call of numSamples took processSeconds */
+    void addBlock (double processSeconds, int numSamples) noexcept
+    {
+        if (numSamples <= 0 || sampleRate <= 0.0)
+            return;
+
+        const double blockSeconds = numSamples / sampleRate;
+        const double load = processSeconds / blockSeconds;
+
+        // One-pole smoothing over wall-clock time, independent of the block size
+        smoothedLoad += (1.0 - std::exp (-blockSeconds / smoothingSeconds)) * (load - smoothedLoad);
+
+        if (smoothedLoad > degradeThreshold && level < numLevels - 1)
+        {
+            secondsBelow = 0.0;
+            secondsAbove += blockSeconds;
+
+            if (secondsAbove >= degradeHoldSeconds)
+            {
+                ++level;
+                secondsAbove = 0.0;
+            }
+        }
+        else if (smoothedLoad < restoreThreshold && level > fullQuality)
+        {
+            secondsAbove = 0.0;
+            secondsBelow += blockSeconds;
+
+            if (secondsBelow >= restoreHoldSeconds)
+            {
+                --level;
+                secondsBelow = 0.0;
+            }
+        }
+        else
+        {
+            secondsAbove = 0.0;
+            secondsBelow = 0.0;
+        }
+
+        publishedLevel.store (level, std::memory_order_relaxed);
+        publishedLoad.store (static_cast<float> (smoothedLoad), std::memory_order_relaxed);
+    }
+
+    /** Audio thread: is this degradation active? */
+    bool isActive (Level degradation) const noexcept { return level >= degradation; }
+
+    // Any thread (editor)
+    int getLevel() const noexcept { return publishedLevel.load (std::memory_order_relaxed); }
+    float getLoad() const noexcept { return publishedLoad.load (std::memory_order_relaxed); }
+
+private:
+    //==========================================================================
+    static constexpr double smoothingSeconds = 0.3;
+    static constexpr double degradeThreshold = 0.6;     // 60% of the block duration
+    static constexpr double restoreThreshold = 0.3;
+    static constexpr double degradeHoldSeconds = 0.25;
+    static constexpr double restoreHoldSeconds = 5.0;
+
+    double sampleRate = 0.0;
+    double smoothedLoad = 0.0;
+    double secondsAbove = 0.0;
+    double secondsBelow = 0.0;
+    int level = fullQuality;
+
+    std::atomic<int> publishedLevel { fullQuality };
+    std::atomic<float> publishedLoad { 0.0f };
+};
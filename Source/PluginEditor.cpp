@@ -5,6 +5,9 @@
 //==============================================================================
 TapMatrixAudioProcessorEditor::TapMatrixAudioProcessorEditor (TapMatrixAudioProcessor& p)
     : AudioProcessorEditor (&p), audioProcessor (p)
+   #if TAPMATRIX_PROFILING
+    , profilerOverlay (p.getStageProfiler())
+   #endif
 {
     // Restore scale factor from processor state
     currentScaleFactor = p.getUIScaleFactor();
@@ -15,7 +18,8 @@ TapMatrixAudioProcessorEditor::TapMatrixAudioProcessorEditor (TapMatrixAudioProc
     // Setup resize handle
     setupResizeHandle();
     
-    // Setup 3D Surround Stage View
+    // Setup 3D Surround Stage View (tap pucks follow the tap parameters and meters)
+    surroundStageView.setTapSource (p.getParameters(), [&p] (int tapIndex) { return p.getTapLevel (tapIndex); });
     addAndMakeVisible (surroundStageView);
     
     // Setup view preset selector
@@ -24,11 +28,15 @@ TapMatrixAudioProcessorEditor::TapMatrixAudioProcessorEditor (TapMatrixAudioProc
     // Setup tap tab bar and panels
     setupTapPanels();
     
+    // Setup CPU load governor status
+    setupLoadGovernorLabel();
+    
     // Apply restored scale factor to all child components
     updateAllComponentScales();
     
-    // Start timer to sync view preset state (30 FPS is enough for UI sync)
-    startTimerHz (30);
+   #if TAPMATRIX_PROFILING
+    addChildComponent (profilerOverlay);
+   #endif
     
     // Set plugin window size based on restored scale factor
     // Base size: 1100x820 (aspect ratio 55:41)
@@ -38,8 +46,6 @@ TapMatrixAudioProcessorEditor::TapMatrixAudioProcessorEditor (TapMatrixAudioProc
 
 TapMatrixAudioProcessorEditor::~TapMatrixAudioProcessorEditor()
 {
-    stopTimer();
-    
     // Clear look and feel from all tap panel sliders before destroying
     for (auto& panel : tapPanels)
     {
@@ -59,15 +65,8 @@ void TapMatrixAudioProcessorEditor::paint (juce::Graphics& g)
 
 void TapMatrixAudioProcessorEditor::resized()
 {
-    auto bounds = getLocalBounds();
-    const float scale = currentScaleFactor;
-    
-    // Scale all layout constants
-    const int padding = static_cast<int> (20 * scale);
-    const int viewportSize = static_cast<int> (400 * scale);  // Slightly smaller to make room for tap panel
-    const int selectorHeight = static_cast<int> (28 * scale);
-    const int selectorWidth = static_cast<int> (320 * scale);
-    const int tabBarHeight = static_cast<int> (24 * scale);
+    const auto bounds = getLocalBounds();
+    const auto& layout = getLayout();
     
     // Resize handle in bottom-right corner (always 16x16, unscaled)
     resizeHandle.setBounds (bounds.getRight() - ResizeHandle::handleSize,
@@ -76,40 +75,99 @@ void TapMatrixAudioProcessorEditor::resized()
                             ResizeHandle::handleSize);
     resizeHandle.toFront (false);
     
+   #if TAPMATRIX_PROFILING
+    profilerOverlay.setBounds (bounds.getRight() - 440, 0, 440, 150);
+    profilerOverlay.toFront (false);
+   #endif
+    
+    surroundStageView.setBounds (layout.surroundStageView);
+    viewPresetSelector.setBounds (layout.viewPresetSelector);
+    loadGovernorLabel.setBounds (layout.loadGovernorLabel);
+    loadGovernorLabel.setFont (layout.loadGovernorFont);
+    tapTabBar.setBounds (layout.tapTabBar);
+    
+    // Tap panel - only the visible one is laid out; others are positioned when shown
+    tapPanelArea = layout.tapPanelArea;
+    if (tapPanels[currentTapIndex])
+        layoutTapPanel (*tapPanels[currentTapIndex]);
+}
+
+const TapMatrixAudioProcessorEditor::Layout& TapMatrixAudioProcessorEditor::getLayout()
+{
+    const auto bounds = getLocalBounds();
+    auto& cached = layoutCache[(size_t) UIScaling::getStepIndex (currentScaleFactor)];
+    
+    // Normally the window size follows the scale, so each step is computed once
+    if (cached == nullptr || cached->bounds != bounds)
+        cached = std::make_unique<Layout> (computeLayout (bounds, currentScaleFactor));
+    
+    return *cached;
+}
+
+TapMatrixAudioProcessorEditor::Layout TapMatrixAudioProcessorEditor::computeLayout (juce::Rectangle<int> bounds, float scale)
+{
+    Layout layout;
+    layout.bounds = bounds;
+    
+    // Scale all layout constants
+    const int padding = static_cast<int> (20 * scale);
+    const int viewportSize = static_cast<int> (400 * scale);  // Slightly smaller to make room for tap panel
+    const int selectorHeight = static_cast<int> (28 * scale);
+    const int selectorWidth = static_cast<int> (320 * scale);
+    const int tabBarHeight = static_cast<int> (24 * scale);
+    
     // Left side: 3D viewport with padding
     auto viewportArea = bounds.removeFromLeft (viewportSize + padding * 2);
     viewportArea.reduce (padding, padding);
     
     // Position viewport
-    surroundStageView.setBounds (viewportArea.removeFromTop (viewportSize));
+    layout.surroundStageView = viewportArea.removeFromTop (viewportSize);
     
     // View preset selector below viewport (centered)
     viewportArea.removeFromTop (static_cast<int> (10 * scale)); // spacing
     auto selectorArea = viewportArea.removeFromTop (selectorHeight);
-    selectorArea = selectorArea.withSizeKeepingCentre (selectorWidth, selectorHeight);
-    viewPresetSelector.setBounds (selectorArea);
+    layout.viewPresetSelector = selectorArea.withSizeKeepingCentre (selectorWidth, selectorHeight);
+    
+    // Load governor status below the selector
+    viewportArea.removeFromTop (static_cast<int> (8 * scale)); // spacing
+    layout.loadGovernorLabel = viewportArea.removeFromTop (static_cast<int> (18 * scale));
+    layout.loadGovernorFont = TextStyles::regular (TextStyles::fontSizeMedium, scale);
     
     // Right side: Tap controls area
     auto controlsArea = bounds;
     controlsArea.reduce (padding, padding);
     
     // Tab bar at top
-    tapTabBar.setBounds (controlsArea.removeFromTop (tabBarHeight));
+    layout.tapTabBar = controlsArea.removeFromTop (tabBarHeight);
     
     // Spacing between tab bar and panel
     controlsArea.removeFromTop (static_cast<int> (8 * scale));
+    layout.tapPanelArea = controlsArea;
     
-    // Tap panels - use preferred height, constrained to available space
-    for (auto& panel : tapPanels)
+    return layout;
+}
+
+void TapMatrixAudioProcessorEditor::layoutTapPanel (TapPanel& panel)
+{
+    // Use preferred height, constrained to available space
+    int preferredHeight = panel.getPreferredHeight();
+    int panelHeight = juce::jmin (preferredHeight, tapPanelArea.getHeight());
+    panel.setBounds (tapPanelArea.getX(), tapPanelArea.getY(), 
+                     tapPanelArea.getWidth(), panelHeight);
+}
+
+void TapMatrixAudioProcessorEditor::mouseDown (const juce::MouseEvent& e)
+{
+   #if TAPMATRIX_PROFILING
+    // Alt+Shift+click toggles the diagnostics overlay
+    if (e.mods.isAltDown() && e.mods.isShiftDown())
     {
-        if (panel)
-        {
-            int preferredHeight = panel->getPreferredHeight();
-            int panelHeight = juce::jmin (preferredHeight, controlsArea.getHeight());
-            panel->setBounds (controlsArea.getX(), controlsArea.getY(), 
-                              controlsArea.getWidth(), panelHeight);
-        }
+        profilerOverlay.setVisible (! profilerOverlay.isVisible());
+        profilerOverlay.refresh();
     }
+   #else
+    juce::ignoreUnused (e);
+   #endif
 }
 
 void TapMatrixAudioProcessorEditor::setupViewPresetSelector()
@@ -124,9 +182,18 @@ void TapMatrixAudioProcessorEditor::setupViewPresetSelector()
 
 void TapMatrixAudioProcessorEditor::setupResizeHandle()
 {
+    // Coalesced to one scale change per frame (see updateResize)
     resizeHandle.onResize = [this] (float newScale)
     {
-        setUIScaleFactorAndResize (newScale);
+        pendingScaleFactor = newScale;
+    };
+    
+    resizeHandle.onResizeEnd = [this]
+    {
+        if (pendingScaleFactor > 0.0f)
+            setUIScaleFactorAndResize (std::exchange (pendingScaleFactor, 0.0f));
+        
+        setResizePreview (false);
     };
     
     addAndMakeVisible (resizeHandle);
@@ -138,18 +205,23 @@ void TapMatrixAudioProcessorEditor::setupTapPanels()
     tapTabBar.onTabSelected = [this] (int index) { showTapPanel (index); };
     addAndMakeVisible (tapTabBar);
     
-    // Create all 8 tap panels
-    for (int i = 0; i < NUM_TAPS; ++i)
+    // Only the first panel is built now; the rest are created when first selected
+    currentTapIndex = 0;
+    getOrCreateTapPanel (currentTapIndex).setVisible (true);
+}
+
+TapPanel& TapMatrixAudioProcessorEditor::getOrCreateTapPanel (int index)
+{
+    auto& panel = tapPanels[index];
+    
+    if (panel == nullptr)
     {
-        tapPanels[i] = std::make_unique<TapPanel> (i, audioProcessor.getParameters());
-        tapPanels[i]->setSliderLookAndFeel (&customLookAndFeel);
-        addAndMakeVisible (*tapPanels[i]);
-        
-        // Only show the first panel initially
-        tapPanels[i]->setVisible (i == 0);
+        panel = std::make_unique<TapPanel> (index, audioProcessor.getParameters());
+        panel->setSliderLookAndFeel (&customLookAndFeel);
+        addChildComponent (*panel);
     }
     
-    currentTapIndex = 0;
+    return *panel;
 }
 
 void TapMatrixAudioProcessorEditor::showTapPanel (int index)
@@ -157,14 +229,20 @@ void TapMatrixAudioProcessorEditor::showTapPanel (int index)
     if (index < 0 || index >= NUM_TAPS || index == currentTapIndex)
         return;
     
-    // Hide current panel
+    // Hide current panel and stop it following parameter changes
     if (tapPanels[currentTapIndex])
+    {
         tapPanels[currentTapIndex]->setVisible (false);
+        tapPanels[currentTapIndex]->setParameterAttachmentsSuspended (true);
+    }
     
-    // Show new panel
+    // Show new panel (created on first selection), bringing its faders, scale and layout up to date
     currentTapIndex = index;
-    if (tapPanels[currentTapIndex])
-        tapPanels[currentTapIndex]->setVisible (true);
+    auto& panel = getOrCreateTapPanel (currentTapIndex);
+    panel.setParameterAttachmentsSuspended (false);
+    panel.setScaleFactor (currentScaleFactor);
+    layoutTapPanel (panel);
+    panel.setVisible (true);
 }
 
 void TapMatrixAudioProcessorEditor::setUIScaleFactorAndResize (float newScale)
@@ -193,12 +271,9 @@ void TapMatrixAudioProcessorEditor::updateAllComponentScales()
     // Update tap tab bar
     tapTabBar.setScaleFactor (currentScaleFactor);
     
-    // Update all tap panels
-    for (auto& panel : tapPanels)
-    {
-        if (panel)
-            panel->setScaleFactor (currentScaleFactor);
-    }
+    // Update the visible tap panel (hidden ones catch up when shown)
+    if (tapPanels[currentTapIndex])
+        tapPanels[currentTapIndex]->setScaleFactor (currentScaleFactor);
     
     // Update ViewPresetSelector with scale factor
     viewPresetSelector.setScaleFactor (currentScaleFactor);
@@ -206,9 +281,90 @@ void TapMatrixAudioProcessorEditor::updateAllComponentScales()
     // TODO: Add setScaleFactor to SurroundStageView when needed
 }
 
-void TapMatrixAudioProcessorEditor::timerCallback()
+void TapMatrixAudioProcessorEditor::updateResize (double elapsedSeconds)
 {
-    // Sync the selector with the SurroundStageView's current preset
+    if (pendingScaleFactor > 0.0f)
+    {
+        // Cheap preview until the size settles, then full-quality frames
+        setResizePreview (true);
+        setUIScaleFactorAndResize (std::exchange (pendingScaleFactor, 0.0f));
+        secondsSinceScaleChange = 0.0;
+    }
+    else if (resizePreviewActive && (secondsSinceScaleChange += elapsedSeconds) >= resizeSettleSeconds)
+    {
+        setResizePreview (false);
+    }
+}
+
+void TapMatrixAudioProcessorEditor::setResizePreview (bool shouldPreview)
+{
+    if (resizePreviewActive == shouldPreview)
+        return;
+    
+    resizePreviewActive = shouldPreview;
+    
+    // Hidden panels aren't painted, so only the visible one needs to know
+    if (tapPanels[currentTapIndex])
+        tapPanels[currentTapIndex]->setResizePreview (shouldPreview);
+}
+
+void TapMatrixAudioProcessorEditor::updateFrame (double elapsedSeconds)
+{
+    // Apply the latest resize handle scale, if any
+    updateResize (elapsedSeconds);
+    
+    // Animations
+    surroundStageView.advanceAnimation (elapsedSeconds);
+    surroundStageView.updateTaps (elapsedSeconds);
+    viewPresetSelector.advanceAnimation (elapsedSeconds);
+    
+    // Sync the selector with the SurroundStageView's current preset (only when it changes)
     auto currentPreset = surroundStageView.getCurrentPreset();
-    viewPresetSelector.setCurrentPreset (currentPreset);
+    if (currentPreset != displayedViewPreset)
+    {
+        displayedViewPreset = currentPreset;
+        viewPresetSelector.setCurrentPreset (currentPreset);
+    }
+    
+    updateLoadGovernorLabel();
+    
+   #if TAPMATRIX_PROFILING
+    // The profiler publishes twice a second - no need to poll faster
+    if (profilerOverlay.isVisible() && (profilerRefreshSeconds -= elapsedSeconds) <= 0.0)
+    {
+        profilerOverlay.refresh();
+        profilerRefreshSeconds = 0.5;
+    }
+   #endif
+}
+
+//==============================================================================
+// CPU Load Governor Status
+//==============================================================================
+
+void TapMatrixAudioProcessorEditor::setupLoadGovernorLabel()
+{
+    loadGovernorLabel.setJustificationType (juce::Justification::centred);
+    loadGovernorLabel.setColour (juce::Label::textColourId, TextStyles::colorWarning);
+    loadGovernorLabel.setInterceptsMouseClicks (false, false);
+    addChildComponent (loadGovernorLabel);
+}
+
+void TapMatrixAudioProcessorEditor::updateLoadGovernorLabel()
+{
+    const auto& governor = audioProcessor.getLoadGovernor();
+    const int level = governor.getLevel();
+    
+    // At full quality the label is hidden, so the load reading doesn't matter
+    const bool loadChanged = level != LoadGovernor::fullQuality
+                          && displayedLoadPercent.update (juce::roundToInt (governor.getLoad() * 100.0f));
+    
+    if (level == displayedLoadLevel && ! loadChanged)
+        return;
+    
+    displayedLoadLevel = level;
+    loadGovernorLabel.setVisible (level != LoadGovernor::fullQuality);
+    loadGovernorLabel.setText ("CPU overload - reduced quality: " + juce::String (LoadGovernor::getLevelName (level))
+                                   + " (" + juce::String (displayedLoadPercent.get()) + "%)",
+                               juce::dontSendNotification);
 }
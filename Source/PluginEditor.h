@@ -9,6 +9,9 @@
 #include "ViewPresetSelector.h"
 #include "ResizeHandle.h"
 #include "TapPanel.h"
+#include "ProfilerOverlay.h"
+#include "TextStyles.h"
+#include "FrameScheduler.h"
 #include <memory>
 #include <array>
 
@@ -19,9 +22,16 @@
  * Supports UI scaling from 1.0x to 3.0x with locked 55:41 aspect ratio.
  * Base size is 1100x820 pixels. Scale factor is stepped by 0.1.
  * All child components should call getScaleFactor() to scale their dimensions.
+ * 
+ * All periodic UI work runs from one frame scheduler (see FrameScheduler.h):
+ * no child component owns a timer.
+ * 
+ * Dragging the resize handle applies at most one scale change per frame, and
+ * the layout for each scale step is computed once and cached. While the drag
+ * is moving, faders stretch the frames they already have; they resample for
+ * the new size (in the background) once the size has settled.
  */
-class TapMatrixAudioProcessorEditor : public juce::AudioProcessorEditor,
-                                       public juce::Timer
+class TapMatrixAudioProcessorEditor : public juce::AudioProcessorEditor
 {
 public:
     TapMatrixAudioProcessorEditor (TapMatrixAudioProcessor&);
@@ -29,9 +39,7 @@ public:
 
     void paint (juce::Graphics&) override;
     void resized() override;
-    
-    // Timer callback to sync view preset state
-    void timerCallback() override;
+    void mouseDown (const juce::MouseEvent&) override;
     
     //==========================================================================
     // UI SCALING
@@ -55,9 +63,10 @@ private:
     // Tap tab bar (selects which tap panel is visible)
     TapTabBar tapTabBar;
     
-    // All 8 tap panels (only one visible at a time)
+    // Tap panels, created the first time each is selected (only one visible and attached at a time)
     std::array<std::unique_ptr<TapPanel>, NUM_TAPS> tapPanels;
     int currentTapIndex = 0;
+    juce::Rectangle<int> tapPanelArea;  // Space below the tab bar, set in resized()
     
     // 3D Surround Stage View
     SurroundStageView surroundStageView;
@@ -71,11 +80,53 @@ private:
     // Current UI scale factor (1.0 to 3.0)
     float currentScaleFactor = 1.0f;
     
+    // Resize handle drag: the latest requested scale is applied on the next frame (0 = none pending)
+    static constexpr double resizeSettleSeconds = 0.25;  // No new size for this long ends the preview
+    float pendingScaleFactor = 0.0f;
+    bool resizePreviewActive = false;
+    double secondsSinceScaleChange = 0.0;
+    
+    // Child bounds and fonts for one scale step and window size
+    struct Layout
+    {
+        juce::Rectangle<int> bounds;  // Window size this was computed for
+        juce::Rectangle<int> surroundStageView, viewPresetSelector, loadGovernorLabel, tapTabBar, tapPanelArea;
+        juce::Font loadGovernorFont { juce::FontOptions() };
+    };
+    
+    std::array<std::unique_ptr<Layout>, UIScaling::numScaleSteps> layoutCache;
+    
+    // CPU load governor status (hidden at full quality)
+    juce::Label loadGovernorLabel;
+    int displayedLoadLevel = LoadGovernor::fullQuality;
+    VisualValue<int> displayedLoadPercent { 5 };
+    
+    // Last view preset shown by the selector
+    SurroundStageView::ViewPreset displayedViewPreset = SurroundStageView::ViewPreset::Angle;
+    
+   #if TAPMATRIX_PROFILING
+    // Hidden DSP timing overlay (Alt+Shift+click the background)
+    ProfilerOverlay profilerOverlay;
+    double profilerRefreshSeconds = 0.0;
+   #endif
+    
+    // Drives every animation and poll; declared last so it stops before anything it touches is destroyed
+    FrameScheduler frameScheduler { *this, [this] (double elapsedSeconds) { updateFrame (elapsedSeconds); } };
+    
     void setupTapPanels();
     void showTapPanel (int index);
+    TapPanel& getOrCreateTapPanel (int index);
+    void layoutTapPanel (TapPanel& panel);
     void setupViewPresetSelector();
     void setupResizeHandle();
+    void setupLoadGovernorLabel();
+    void updateLoadGovernorLabel();
     void updateAllComponentScales();  // Update scale factor on all child components
+    void updateResize (double elapsedSeconds);
+    void setResizePreview (bool shouldPreview);
+    const Layout& getLayout();
+    static Layout computeLayout (juce::Rectangle<int> bounds, float scale);
+    void updateFrame (double elapsedSeconds);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (TapMatrixAudioProcessorEditor)
 };
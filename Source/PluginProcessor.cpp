@@ -12,10 +12,21 @@ TapMatrixAudioProcessor::TapMatrixAudioProcessor()
     for (int i = 0; i < NUM_TAPS; ++i)
         for (int j = 0; j < NUM_TAPS; ++j)
             crosstalkMatrix[i][j] = 0.0f;
+    
+    resolveParameterPointers();
+    initialisePresetLibrary();
+    
+    userPresetBank->addChangeListener (this);
+    
+   #if TAPMATRIX_PROFILING
+    if (wrapperType == wrapperType_Standalone)
+        profilingConsoleReporter = std::make_unique<StageProfiling::ConsoleReporter> (stageProfiler);
+   #endif
 }
 
 TapMatrixAudioProcessor::~TapMatrixAudioProcessor()
 {
+    userPresetBank->removeChangeListener (this);
 }
 
 juce::String TapMatrixAudioProcessor::getTapParamID (const char* paramName, int tapIndex)
@@ -23,6 +34,38 @@ juce::String TapMatrixAudioProcessor::getTapParamID (const char* paramName, int
     return juce::String (paramName) + juce::String (tapIndex + 1);
 }
 
+void TapMatrixAudioProcessor::resolveParameterPointers()
+{
+    using namespace BinaryStateFormat;
+    
+    for (int i = 0; i < NUM_TAPS; ++i)
+    {
+        for (int p = 0; p < numTapParameters; ++p)
+            tapControls[i].params[p] = parameters.getRawParameterValue (getTapParamID (tapParameterNames[p], i));
+        
+        tapControls[i].inputSourceParam = parameters.getRawParameterValue (getTapParamID (tapParameterNamesV2[tapInputSource], i));
+        
+        for (int p = 0; p < numTapParametersV3; ++p)
+            tapControls[i].modulationParams[p] = parameters.getRawParameterValue (getTapParamID (tapParameterNamesV3[p], i));
+    }
+    
+    for (int p = 0; p < numGlobalParameters; ++p)
+        globalControls.params[p] = parameters.getRawParameterValue (globalParameterNames[p]);
+    
+    // Parameters in stable binary-state order
+    stateParameterIDs = getParameterIDs (NUM_TAPS);
+    
+    for (auto& paramID : stateParameterIDs)
+    {
+        auto* param = parameters.getParameter (paramID);
+        jassert (param != nullptr);  // Every stable ID must exist in the layout
+        stateParameters.add (param);
+    }
+    
+    // Preset snapshots use the same order (sized once, never reallocated)
+    presetSnapshot.resize (static_cast<size_t> (stateParameters.size()), 0.0f);
+}
+
 juce::AudioProcessorValueTreeState::ParameterLayout TapMatrixAudioProcessor::createParameterLayout()
 {
     juce::AudioProcessorValueTreeState::ParameterLayout layout;
@@ -136,6 +179,93 @@ juce::AudioProcessorValueTreeState::ParameterLayout TapMatrixAudioProcessor::cre
             0.25f * (i + 1),  // Spread taps: 0.25, 0.5, 0.75... quarter notes
             "beats"
         ));
+        
+        // Input source (mono sum of all inputs, one input channel, or a channel pair)
+        layout.add (std::make_unique<juce::AudioParameterChoice> (
+            getTapParamID ("inputSource", i),
+            tapName + " Input",
+            InputRouter::getSourceNames(),
+            InputRouter::monoSum
+        ));
+        
+        // Modulation LFO shape
+        layout.add (std::make_unique<juce::AudioParameterChoice> (
+            getTapParamID ("lfoShape", i),
+            tapName + " LFO Shape",
+            LfoBank<NUM_TAPS>::getShapeNames(),
+            LfoBank<NUM_TAPS>::sine
+        ));
+        
+        // LFO rate: 0.01-20 Hz (free-running)
+        layout.add (std::make_unique<juce::AudioParameterFloat> (
+            getTapParamID ("lfoRate", i),
+            tapName + " LFO Rate",
+            juce::NormalisableRange<float> (0.01f, 20.0f, 0.01f, 0.3f),
+            1.0f,
+            "Hz"
+        ));
+        
+        // LFO SYNC toggle (false = rate in Hz, true = cycle length in beats)
+        layout.add (std::make_unique<juce::AudioParameterBool> (
+            getTapParamID ("lfoSync", i),
+            tapName + " LFO Sync",
+            false
+        ));
+        
+        // LFO cycle length (0.25-16 quarter notes, only used when lfoSync = true)
+        layout.add (std::make_unique<juce::AudioParameterFloat> (
+            getTapParamID ("lfoSyncBeats", i),
+            tapName + " LFO Sync Length",
+            juce::NormalisableRange<float> (0.25f, 16.0f, 0.25f, 0.5f),
+            4.0f,
+            "beats"
+        ));
+        
+        // Delay time modulation depth: +/- 0-50ms
+        layout.add (std::make_unique<juce::AudioParameterFloat> (
+            getTapParamID ("lfoDelayDepth", i),
+            tapName + " LFO Delay Depth",
+            juce::NormalisableRange<float> (0.0f, 50.0f, 0.01f, 0.5f),
+            0.0f,
+            "ms"
+        ));
+        
+        // Pan X / Pan Y modulation depth: +/- 0-100
+        layout.add (std::make_unique<juce::AudioParameterFloat> (
+            getTapParamID ("lfoPanXDepth", i),
+            tapName + " LFO Pan X Depth",
+            juce::NormalisableRange<float> (0.0f, 1.0f, 0.01f),
+            0.0f,
+            ""
+        ));
+        
+        layout.add (std::make_unique<juce::AudioParameterFloat> (
+            getTapParamID ("lfoPanYDepth", i),
+            tapName + " LFO Pan Y Depth",
+            juce::NormalisableRange<float> (0.0f, 1.0f, 0.01f),
+            0.0f,
+            ""
+        ));
+        
+        // Gain modulation depth: dips by 0-24 dB at the LFO minimum
+        layout.add (std::make_unique<juce::AudioParameterFloat> (
+            getTapParamID ("lfoGainDepth", i),
+            tapName + " LFO Gain Depth",
+            juce::NormalisableRange<float> (0.0f, 24.0f, 0.1f),
+            0.0f,
+            "dB"
+        ));
+        
+        // Reverb modulation depth: +/- 0-100%
+        layout.add (std::make_unique<juce::AudioParameterFloat> (
+            getTapParamID ("lfoReverbDepth", i),
+            tapName + " LFO Reverb Depth",
+            juce::NormalisableRange<float> (0.0f, 1.0f, 0.01f),
+            0.0f,
+            "%",
+            juce::AudioProcessorParameter::genericParameter,
+            [](float value, int) { return juce::String (value * 100.0f, 1); }
+        ));
     }
     
     // Global parameters
@@ -208,6 +338,39 @@ juce::AudioProcessorValueTreeState::ParameterLayout TapMatrixAudioProcessor::cre
         true  // Default ON for smooth, glitch-free delay changes
     ));
     
+    // Tape Wow (slow delay modulation, tape mode only)
+    layout.add (std::make_unique<juce::AudioParameterFloat> (
+        "tapeWow",
+        "Tape Wow",
+        juce::NormalisableRange<float> (0.0f, 1.0f, 0.01f),
+        0.0f,
+        "%",
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String (value * 100.0f, 1); }
+    ));
+    
+    // Tape Flutter (fast delay modulation, tape mode only)
+    layout.add (std::make_unique<juce::AudioParameterFloat> (
+        "tapeFlutter",
+        "Tape Flutter",
+        juce::NormalisableRange<float> (0.0f, 1.0f, 0.01f),
+        0.0f,
+        "%",
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String (value * 100.0f, 1); }
+    ));
+    
+    // Tape Saturation (feedback path waveshaping, tape mode only)
+    layout.add (std::make_unique<juce::AudioParameterFloat> (
+        "tapeSaturation",
+        "Tape Saturation",
+        juce::NormalisableRange<float> (0.0f, 1.0f, 0.01f),
+        0.0f,
+        "%",
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String (value * 100.0f, 1); }
+    ));
+    
     return layout;
 }
 
@@ -256,7 +419,8 @@ double TapMatrixAudioProcessor::getTailLengthSeconds() const
 
 int TapMatrixAudioProcessor::getNumPrograms()
 {
-    return NUM_FACTORY_PRESETS;
+    // Factory presets first, then the user preset bank
+    return NUM_FACTORY_PRESETS + userPresetBank->getNumPresets();
 }
 
 int TapMatrixAudioProcessor::getCurrentProgram()
@@ -266,15 +430,22 @@ int TapMatrixAudioProcessor::getCurrentProgram()
 
 void TapMatrixAudioProcessor::setCurrentProgram (int index)
 {
-    if (index >= 0 && index < NUM_FACTORY_PRESETS)
+    if (index >= 0 && index < getNumPrograms())
     {
         currentPresetIndex = index;
-        loadFactoryPreset (index);
+        
+        if (index < NUM_FACTORY_PRESETS)
+            loadFactoryPreset (index);
+        else
+            loadUserPreset (index - NUM_FACTORY_PRESETS);
     }
 }
 
 const juce::String TapMatrixAudioProcessor::getProgramName (int index)
 {
+    if (index >= NUM_FACTORY_PRESETS)
+        return userPresetBank->getPresetName (index - NUM_FACTORY_PRESETS);
+    
     switch (index)
     {
         case 0: return "Init (Default)";
@@ -298,58 +469,113 @@ void TapMatrixAudioProcessor::changeProgramName (int index, const juce::String&
 //==============================================================================
 void TapMatrixAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
-    // Prepare all 8 delay taps
-    for (auto& tap : taps)
-        tap.prepareToPlay (sampleRate, MAX_DELAY_MS);
+    // The engine runs at the host's precision; the other precision's buffers are freed
+    const bool processDoubles = isUsingDoublePrecision();
+    
+    if (processDoubles)
+        prepareEngine (doubleEngine, floatEngine, sampleRate);
+    else
+        prepareEngine (floatEngine, doubleEngine, sampleRate);
+    
+    dampingFilters.reset();
+    lfoBank.reset();
+    
+    // Build the shared saturation table off the audio thread
+    juce::ignoreUnused (TapeEngine::SaturationTable::getInstance());
+    
+    // Scratch buffers hold one sub-block (see MAX_SUB_BLOCK_SIZE), whatever the host announces
+    juce::ignoreUnused (samplesPerBlock);
+    
+    // Prepare input sources (mono sum, channels and pairs)
+    inputRouter.prepare (MAX_SUB_BLOCK_SIZE, processDoubles);
+    
+    // Prepare reverb scratch buffer (one tap at a time)
+    reverbBuffer.setSize (1, MAX_SUB_BLOCK_SIZE);
     
-    // Prepare mono input buffer
-    monoInputBuffer.setSize (1, samplesPerBlock);
+    // Initialize reverb parameters based on current type
+    updateReverbParameters();
+    
+    // Reset ducking envelope
+    duckingEnvelopeSq = 0.0f;
+    
+    // Envelope follower coefficients
+    duckingAttackCoeff = 1.0f - std::exp (-1.0f / (0.001f * static_cast<float> (sampleRate)));   // 1ms attack
+    duckingReleaseCoeff = 1.0f - std::exp (-1.0f / (0.050f * static_cast<float> (sampleRate)));  // 50ms release
+    
+    // Preset fade length per stage, rounded up to whole control blocks so the
+    // parameter swap always lands on a control boundary
+    const int fadeSamples = static_cast<int> (std::ceil (PRESET_FADE_SECONDS * sampleRate));
+    presetFadeLength = juce::jmax (1, (fadeSamples + CONTROL_BLOCK_SIZE - 1) / CONTROL_BLOCK_SIZE) * CONTROL_BLOCK_SIZE;
+    presetFadeStage = PresetFadeStage::idle;
+    presetFadePosition = 0;
+    
+    // Start at full quality
+    loadGovernor.prepare (sampleRate);
+    tapReverbsRunning.fill (false);
+    
+    // Start smoothed parameters at their current values (no ramp on first block)
+    resetControlState (sampleRate);
+}
+
+template <typename SampleType, typename UnusedSampleType>
+void TapMatrixAudioProcessor::prepareEngine (EngineState<SampleType>& engine, EngineState<UnusedSampleType>& unusedEngine,
+                                             double sampleRate)
+{
+    // Prepare all 8 delay taps
+    for (int i = 0; i < NUM_TAPS; ++i)
+    {
+        engine.taps[i].prepareToPlay (sampleRate, MAX_DELAY_MS);
+        engine.taps[i].tape.prepare (i, sampleRate);
+        unusedEngine.taps[i].release();
+    }
     
     // Prepare tap output buffer (8 taps, mono each)
-    tapOutputBuffer.setSize (NUM_TAPS, samplesPerBlock);
+    engine.tapOutputBuffer.setSize (NUM_TAPS, MAX_SUB_BLOCK_SIZE);
+    unusedEngine.tapOutputBuffer.setSize (NUM_TAPS, 0);
     
     // Prepare crosstalk buffer (pre-allocate to avoid real-time malloc)
-    crosstalkBuffer.setSize (NUM_TAPS, samplesPerBlock);
+    engine.crosstalkBuffer.setSize (NUM_TAPS, MAX_SUB_BLOCK_SIZE);
+    unusedEngine.crosstalkBuffer.setSize (NUM_TAPS, 0);
     
     // Prepare dry buffer (max 8 channels for 7.1)
-    dryBuffer.setSize (MAX_CHANNELS, samplesPerBlock);
+    engine.dryBuffer.setSize (MAX_CHANNELS, MAX_SUB_BLOCK_SIZE);
+    unusedEngine.dryBuffer.setSize (MAX_CHANNELS, 0);
     
     // Prepare reverb for each tap
     juce::dsp::ProcessSpec spec;
     spec.sampleRate = sampleRate;
-    spec.maximumBlockSize = static_cast<juce::uint32> (samplesPerBlock);
+    spec.maximumBlockSize = static_cast<juce::uint32> (MAX_SUB_BLOCK_SIZE);
     spec.numChannels = 1;  // Mono reverb per tap
     
-    for (auto& tap : taps)
+    for (auto& tap : engine.taps)
         tap.reverb.prepare (spec);
     
-    // Initialize reverb parameters based on current type
-    updateReverbParameters();
-    
     // Prepare global filters (HPF/LPF)
     juce::dsp::ProcessSpec filterSpec;
     filterSpec.sampleRate = sampleRate;
-    filterSpec.maximumBlockSize = static_cast<juce::uint32> (samplesPerBlock);
+    filterSpec.maximumBlockSize = static_cast<juce::uint32> (MAX_SUB_BLOCK_SIZE);
     filterSpec.numChannels = 1;  // Process each channel independently
     
     for (int i = 0; i < MAX_CHANNELS; ++i)
     {
-        hpFilters[i].prepare (filterSpec);
-        lpFilters[i].prepare (filterSpec);
+        engine.hpFilters[i].prepare (filterSpec);
+        engine.lpFilters[i].prepare (filterSpec);
         
         // Set filter types (12dB/oct = 2-pole)
-        hpFilters[i].setType (juce::dsp::StateVariableTPTFilterType::highpass);
-        lpFilters[i].setType (juce::dsp::StateVariableTPTFilterType::lowpass);
+        engine.hpFilters[i].setType (juce::dsp::StateVariableTPTFilterType::highpass);
+        engine.lpFilters[i].setType (juce::dsp::StateVariableTPTFilterType::lowpass);
     }
-    
-    // Reset ducking envelope
-    duckingEnvelopeSq = 0.0f;
 }
 
 void TapMatrixAudioProcessor::releaseResources()
 {
-    for (auto& tap : taps)
-        tap.reset();
+    forEachEngine ([] (auto& engine)
+    {
+        for (auto& tap : engine.taps)
+            tap.reset();
+    });
+    
+    dampingFilters.reset();
 }
 
 bool TapMatrixAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts) const
@@ -387,20 +613,97 @@ void TapMatrixAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer,
                                            juce::MidiBuffer& midiMessages)
 {
     juce::ignoreUnused (midiMessages);
+    processBlockInternal (buffer);
+}
+
+void TapMatrixAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer,
+                                           juce::MidiBuffer& midiMessages)
+{
+    juce::ignoreUnused (midiMessages);
+    processBlockInternal (buffer);
+}
+
+void TapMatrixAudioProcessor::processBlockBypassed (juce::AudioBuffer<float>& buffer,
+                                                   juce::MidiBuffer& midiMessages)
+{
+    juce::ignoreUnused (midiMessages);
+    processBlockBypassedInternal (buffer);
+}
+
+void TapMatrixAudioProcessor::processBlockBypassed (juce::AudioBuffer<double>& buffer,
+                                                   juce::MidiBuffer& midiMessages)
+{
+    juce::ignoreUnused (midiMessages);
+    processBlockBypassedInternal (buffer);
+}
+
+template <typename SampleType>
+void TapMatrixAudioProcessor::processBlockInternal (juce::AudioBuffer<SampleType>& buffer)
+{
+    juce::ScopedNoDenormals noDenormals;
+    
+    if (bypassTailsFinished)
+    {
+        // Resuming from passthrough: start smoothed values at their current targets
+        bypassTailsFinished = false;
+        resetControlState (getSampleRate());
+    }
+    
+    bypassed = false;
+    bypassSilentSamples = 0;
+    processEngine (buffer);
+}
+
+template <typename SampleType>
+void TapMatrixAudioProcessor::processBlockBypassedInternal (juce::AudioBuffer<SampleType>& buffer)
+{
     juce::ScopedNoDenormals noDenormals;
     
+    bypassed = true;
+    
+    if (bypassTailsFinished)
+    {
+        // Tails have died away: plain passthrough
+        for (auto i = getTotalNumInputChannels(); i < getTotalNumOutputChannels(); ++i)
+            buffer.clear (i, 0, buffer.getNumSamples());
+        return;
+    }
+    
+    // Keep the engine running with its input muted so echoes and reverb decay naturally
+    processEngine (buffer);
+    
+    // Silent for longer than the longest delay: nothing left in the delay lines can become audible
+    const int silenceSamples = static_cast<int> (getSampleRate() * (MAX_DELAY_MS + BYPASS_SILENCE_MARGIN_MS) / 1000.0);
+    if (bypassSilentSamples > silenceSamples && bypassBlend.getCurrentValue() >= 1.0f)
+    {
+        resetEngineState();
+        bypassTailsFinished = true;
+    }
+}
+
+template <typename SampleType>
+void TapMatrixAudioProcessor::processEngine (juce::AudioBuffer<SampleType>& buffer)
+{
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
     const int numSamples = buffer.getNumSamples();
     
+    // Time the whole block for the load governor
+    const auto blockStartTicks = juce::Time::getHighResolutionTicks();
+    
     // Get host tempo for tempo sync (with safety checks)
-    double currentBPM = 120.0;  // Default fallback
+    hostPpqPosition = -1.0;
+    
     if (auto* playHead = getPlayHead())
     {
         if (auto posInfo = playHead->getPosition())
         {
             if (auto bpm = posInfo->getBpm())
                 currentBPM = juce::jlimit (20.0, 999.0, *bpm);  // Clamp to sane range
+            
+            // Tempo-synced LFOs lock to the timeline while the transport runs
+            if (auto ppq = posInfo->getPpqPosition(); ppq && posInfo->getIsPlaying())
+                hostPpqPosition = juce::jmax (0.0, *ppq);
         }
     }
     
@@ -408,201 +711,713 @@ void TapMatrixAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer,
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, numSamples);
     
+    // Process in control-rate sub-blocks. Parameters are read at control boundaries
+    // (which carry across host blocks), so automation resolution and parameter-read
+    // cost depend on elapsed samples rather than on the host block size.
+    int startSample = 0;
+    
+    while (startSample < numSamples)
+    {
+        if (samplesUntilControlUpdate <= 0)
+        {
+            controlPpqPosition = hostPpqPosition < 0.0 ? -1.0
+                               : hostPpqPosition + startSample * currentBPM / (60.0 * getSampleRate());
+            
+            // Under heavy load, control updates (and pan-gain steps) come every other sub-block
+            controlInterval = loadGovernor.isActive (LoadGovernor::coarseControlRate) ? 2 * CONTROL_BLOCK_SIZE
+                                                                                       : CONTROL_BLOCK_SIZE;
+            updateControlState (getEngine<SampleType>());
+            samplesUntilControlUpdate = controlInterval;
+        }
+        
+        // Never larger than the scratch buffers, however large the host block is
+        const int subBlockSize = juce::jmin (numSamples - startSample, samplesUntilControlUpdate, MAX_SUB_BLOCK_SIZE);
+        
+        // Non-owning view into the host buffer (no allocation)
+        juce::AudioBuffer<SampleType> subBuffer (buffer.getArrayOfWritePointers(), buffer.getNumChannels(),
+                                                 startSample, subBlockSize);
+        processSubBlock (subBuffer, totalNumInputChannels);
+        
+        startSample += subBlockSize;
+        samplesUntilControlUpdate -= subBlockSize;
+    }
+    
+    // Meters are smoothed once per host block
+    updateTapMeters();
+    
+   #if TAPMATRIX_PROFILING
+    stageProfiler.endBlock (numSamples, getSampleRate());
+   #endif
+    
+    loadGovernor.addBlock (juce::Time::highResolutionTicksToSeconds (juce::Time::getHighResolutionTicks() - blockStartTicks),
+                           numSamples);
+}
+
+template <typename SampleType>
+void TapMatrixAudioProcessor::processSubBlock (juce::AudioBuffer<SampleType>& buffer, int numInputChannels)
+{
+    const int numSamples = buffer.getNumSamples();
+    jassert (numSamples <= MAX_SUB_BLOCK_SIZE);
+    
+    auto& engine = getEngine<SampleType>();
+    auto& dry = engine.dryBuffer;
+    
     // Step 1: Save dry signal for later mixing
-    dryBuffer.clear();
-    for (int ch = 0; ch < juce::jmin (totalNumInputChannels, MAX_CHANNELS); ++ch)
-        dryBuffer.copyFrom (ch, 0, buffer, ch, 0, numSamples);
+    dry.clear (0, numSamples);
+    for (int ch = 0; ch < juce::jmin (numInputChannels, MAX_CHANNELS); ++ch)
+        dry.copyFrom (ch, 0, buffer, ch, 0, numSamples);
+    
+    // Step 2: Render the tap input sources from the dry copy
+    {
+        TAPMATRIX_PROFILE_STAGE (stageProfiler, inputRouting);
+        inputRouter.process (dry, numInputChannels, 1.0f - bypassBlend.getCurrentValue(), numSamples);
+    }
+    
+    // Step 3: Process all taps (delay + reverb)
+    {
+        TAPMATRIX_PROFILE_STAGE (stageProfiler, taps);
+        processTaps (engine, numSamples);
+    }
+    
+    // Step 4: Apply crosstalk mixing
+    {
+        TAPMATRIX_PROFILE_STAGE (stageProfiler, crosstalk);
+        applyCrosstalk (engine, numSamples);
+    }
+    
+    // Step 5: Apply panning to create wet signal in the output buffer
+    {
+        TAPMATRIX_PROFILE_STAGE (stageProfiler, panning);
+        applyPanning (engine, buffer, numSamples);
+    }
+    
+    // Step 6: Apply global HPF/LPF to wet signal
+    {
+        TAPMATRIX_PROFILE_STAGE (stageProfiler, globalFilters);
+        applyGlobalFilters (engine, buffer, numSamples);
+    }
+    
+    // Step 7: Apply ducking to wet signal based on dry input
+    {
+        TAPMATRIX_PROFILE_STAGE (stageProfiler, ducking);
+        applyDucking (buffer, dry, numSamples);
+    }
+    
+    // Step 8: Fade wet signal around preset switches
+    applyPresetFadeGain (buffer, numSamples);
+    
+    // While bypassed, track how long the delay lines and reverbs have been silent
+    // (measured in processTaps, before tap gain, ducking and the preset fade)
+    if (bypassed)
+        bypassSilentSamples = bypassTailPeak < BYPASS_SILENCE_THRESHOLD ? bypassSilentSamples + numSamples : 0;
+    
+    // Step 9: Mix dry and wet signals
+    {
+        TAPMATRIX_PROFILE_STAGE (stageProfiler, dryWetMix);
+        applyDryWetMix (buffer, dry, buffer, numSamples);
+    }
+    
+    // Step 10: Apply output gain
+    buffer.applyGain (static_cast<SampleType> (globalControls.outputGain.getCurrentValue()));
+    
+    // Step 11: Bring the dry signal to unity while bypassed
+    applyBypassDryGain (buffer, dry, numInputChannels, numSamples);
+}
+
+template <typename SampleType>
+void TapMatrixAudioProcessor::applyBypassDryGain (juce::AudioBuffer<SampleType>& outputBuffer,
+                                                  const juce::AudioBuffer<SampleType>& dryBuffer,
+                                                  int numInputChannels,
+                                                  int numSamples)
+{
+    const float blend = bypassBlend.getCurrentValue();
+    if (blend <= 0.0f)
+        return;
+    
+    // The mix stage already added (1 - mix) * outputGain of the dry signal; top it up to unity.
+    // The wet tails keep their mix and output gain, so they continue at the same level.
+    const float mixedDryGain = (1.0f - globalControls.mix.getCurrentValue()) * globalControls.outputGain.getCurrentValue();
+    const float extraDryGain = blend * (1.0f - mixedDryGain);
+    
+    for (int ch = 0; ch < juce::jmin (outputBuffer.getNumChannels(), numInputChannels, MAX_CHANNELS); ++ch)
+        outputBuffer.addFrom (ch, 0, dryBuffer, ch, 0, numSamples, static_cast<SampleType> (extraDryGain));
+}
+
+void TapMatrixAudioProcessor::resetEngineState()
+{
+    forEachEngine ([] (auto& engine)
+    {
+        for (auto& tap : engine.taps)
+        {
+            tap.reset();
+            tap.reverb.reset();
+        }
+        
+        for (int ch = 0; ch < MAX_CHANNELS; ++ch)
+        {
+            engine.hpFilters[ch].reset();
+            engine.lpFilters[ch].reset();
+        }
+    });
+    
+    dampingFilters.reset();
+    duckingEnvelopeSq = 0.0f;
+}
+
+//==============================================================================
+// Control-Rate Parameter Handling
+//==============================================================================
+
+void TapMatrixAudioProcessor::resetControlState (double sampleRate)
+{
+    const double controlRate = sampleRate / CONTROL_BLOCK_SIZE;
+    
+    for (auto& controls : tapControls)
+    {
+        controls.readTargets();
+        controls.forEachSmoothed ([controlRate] (auto& value) { value.reset (controlRate, CONTROL_RAMP_SECONDS); });
+        controls.hasModulatedValues = false;
+    }
+    
+    globalControls.readTargets();
+    globalControls.forEachSmoothed ([controlRate] (auto& value) { value.reset (controlRate, CONTROL_RAMP_SECONDS); });
+    
+    bypassBlend.reset (controlRate, CONTROL_RAMP_SECONDS);
+    bypassBlend.setCurrentAndTargetValue (bypassed ? 1.0f : 0.0f);
+    
+    samplesUntilControlUpdate = 0;
+}
+
+template <typename SampleType>
+void TapMatrixAudioProcessor::updateControlState (EngineState<SampleType>& engine)
+{
+    const double sampleRate = getSampleRate();
+    
+    // Smoothed values step once per CONTROL_BLOCK_SIZE samples, so ramp times hold
+    // when the governor stretches the control interval
+    const int controlSteps = controlInterval / CONTROL_BLOCK_SIZE;
+    
+    // Targets come from the live parameters, except while a preset switch is in flight:
+    // they are held through the fade-out (the tree is being rewritten) and then follow
+    // the snapshot until the tree matches it
+    const bool presetSwapped = updatePresetFade();
+    
+    if (! presetSnapshotActive && presetFadeStage != PresetFadeStage::fadingOut)
+    {
+        globalControls.readTargets();
+        for (auto& controls : tapControls)
+            controls.readTargets();
+    }
+    
+    if (presetSwapped)
+    {
+        // Wet path is silent: jump straight to the new preset instead of sweeping
+        // through intermediate settings. Mix and output gain still ramp (dry path).
+        auto snap = [] (auto& value) { value.setCurrentAndTargetValue (value.getTargetValue()); };
+        
+        for (auto& controls : tapControls)
+            controls.forEachSmoothed (snap);
+        
+        for (auto* value : { &globalControls.ducking, &globalControls.tapeWow,
+                             &globalControls.tapeFlutter, &globalControls.tapeSaturation })
+            snap (*value);
+        
+        snap (globalControls.hpfFreq);
+        snap (globalControls.lpfFreq);
+    }
+    
+    // Global parameters
+    globalControls.forEachSmoothed ([controlSteps] (auto& value) { value.skip (controlSteps); });
+    
+    // Bypass crossfade (input to taps and dry gain)
+    bypassBlend.setTargetValue (bypassed ? 1.0f : 0.0f);
+    bypassBlend.skip (controlSteps);
+    
+    // Check if reverb type has changed
+    auto newReverbType = static_cast<ReverbType> (globalControls.reverbType);
+    if (newReverbType != currentReverbType)
+    {
+        currentReverbType = newReverbType;
+        updateReverbParameters();
+    }
+    
+    // Tape coefficients are constant for the whole sub-block
+    tapeCoeffs = {};
+    if (globalControls.tapeMode)
+    {
+        tapeCoeffs.update (sampleRate,
+                           globalControls.tapeWow.getCurrentValue(),
+                           globalControls.tapeFlutter.getCurrentValue(),
+                           globalControls.tapeSaturation.getCurrentValue());
+    }
+    else if (std::any_of (tapControls.begin(), tapControls.end(),
+                          [] (const auto& controls) { return controls.lfoDelayDepthMs > 0.0f; }))
+    {
+        // Modulated delay times glide on the tape read head (no wow/flutter/saturation)
+        tapeCoeffs.update (sampleRate, 0.0f, 0.0f, 0.0f);
+    }
+    
+    updateModulation (sampleRate);
+    
+    // Global filter cutoffs (clamp to Nyquist to prevent instability)
+    float nyquist = static_cast<float> (sampleRate) * 0.49f;  // 2% headroom
+    float hpfFreq = juce::jmin (globalControls.hpfFreq.getCurrentValue(), nyquist);
+    float lpfFreq = juce::jmin (globalControls.lpfFreq.getCurrentValue(), nyquist);
+    
+    for (int ch = 0; ch < MAX_CHANNELS; ++ch)
+    {
+        engine.hpFilters[ch].setCutoffFrequency (static_cast<SampleType> (hpfFreq));
+        engine.lpFilters[ch].setCutoffFrequency (static_cast<SampleType> (lpfFreq));
+    }
     
-    // Step 2: Sum input to mono
-    monoInputBuffer.clear();
-    float invNumInputs = 1.0f / juce::jmax (1, totalNumInputChannels);
+    // Per-tap parameters
+    juce::uint32 activeInputSources = 0;
+    
+    for (int tapIndex = 0; tapIndex < NUM_TAPS; ++tapIndex)
+    {
+        auto& controls = tapControls[tapIndex];
+        auto& tap = engine.taps[tapIndex];
+        
+        // Each source is rendered once however many taps read it
+        activeInputSources |= 1u << controls.inputSource;
+        
+        controls.forEachSmoothed ([controlSteps] (auto& value) { value.skip (controlSteps); });
+        
+        const float lfo = lfoBank.getOutput (tapIndex);
+        controls.applyModulation (lfo);
+        
+        // SYNC mode converts beats to milliseconds, TIME mode uses the direct value
+        float delayTimeMs = controls.syncMode ? beatsToMs (controls.syncDelayBeats, currentBPM)
+                                              : controls.delayTimeMs;
+        delayTimeMs += lfo * controls.lfoDelayDepthMs;
+        
+        // Convert delay time to samples
+        tap.targetDelaySamples = (delayTimeMs / 1000.0f) * static_cast<float> (sampleRate);
+        tap.targetDelaySamples = juce::jlimit (1.0f, static_cast<float> (tap.bufferLength - 4), tap.targetDelaySamples);
+        
+        // Initialize current delay on first run (and jump, rather than glide, on a preset swap)
+        if (tap.currentDelaySamples == 0.0f || presetSwapped)
+            tap.currentDelaySamples = tap.targetDelaySamples;
+        
+        // Update damping filter coefficient (0% = bypass, 100% = darkest)
+        dampingFilters.setDamping (tapIndex, controls.damping.getCurrentValue(), sampleRate);
+    }
+    
+    inputRouter.setActiveSources (activeInputSources);
+}
+
+void TapMatrixAudioProcessor::updateModulation (double sampleRate)
+{
+    // Advance every LFO by one control interval (or lock it to the host timeline), then
+    // evaluate all of them in one pass
+    const double blockSeconds = controlInterval / sampleRate;
+    
+    for (int tapIndex = 0; tapIndex < NUM_TAPS; ++tapIndex)
+    {
+        const auto& controls = tapControls[tapIndex];
+        lfoBank.setShape (tapIndex, controls.lfoShape);
+        
+        if (! controls.lfoSync)
+            lfoBank.advance (tapIndex, static_cast<float> (controls.lfoRateHz * blockSeconds));
+        else if (controlPpqPosition >= 0.0)
+            lfoBank.setPhase (tapIndex, controlPpqPosition / controls.lfoSyncBeats);
+        else
+            lfoBank.advance (tapIndex, static_cast<float> (currentBPM / 60.0 * blockSeconds / controls.lfoSyncBeats));
+    }
+    
+    lfoBank.process();
+}
+
+//==============================================================================
+// Preset Switching
+//==============================================================================
+
+void TapMatrixAudioProcessor::publishParameterSnapshot (const std::vector<float>& snapshot)
+{
+    jassert (snapshot.size() == presetSnapshot.size());
+    
+    // 1. Hand the complete preset to the audio thread in one step
+    juce::uint32 generation;
+    {
+        const juce::SpinLock::ScopedLockType lock (presetSnapshotLock);
+        std::copy (snapshot.begin(), snapshot.end(), presetSnapshot.begin());
+        generation = presetSnapshotGeneration.load() + 1;
+        presetSnapshotGeneration = generation;
+    }
+    
+    presetSnapshotPending = true;
+    
+    // 2. Bring the parameter tree and host in line. The audio thread follows the
+    //    snapshot until this completes, so partially applied values are never heard.
+    for (int i = 0; i < stateParameters.size(); ++i)
+    {
+        auto* param = stateParameters.getUnchecked (i);
+        const float normalised = param->convertTo0to1 (snapshot[static_cast<size_t> (i)]);
+        
+        if (param->getValue() != normalised)
+            param->setValueNotifyingHost (normalised);
+    }
     
-    for (int ch = 0; ch < totalNumInputChannels; ++ch)
-        monoInputBuffer.addFrom (0, 0, buffer, ch, 0, numSamples, invNumInputs);
+    presetAppliedGeneration = generation;
     
-    // Step 3: Process all taps (delay + reverb) with tempo sync
-    processTaps (monoInputBuffer.getReadPointer (0), numSamples, currentBPM);
+    // 3. One host refresh for the whole preset
+    updateHostDisplay (ChangeDetails().withProgramChanged (true));
+}
+
+bool TapMatrixAudioProcessor::updatePresetFade()
+{
+    switch (presetFadeStage)
+    {
+        case PresetFadeStage::idle:
+            // A snapshot swapped in during a fade-out may already be the latest one
+            if (presetSnapshotPending.exchange (false)
+                && ! (presetSnapshotActive && presetSnapshotGeneration.load() == activeSnapshotGeneration))
+            {
+                presetFadeStage = PresetFadeStage::fadingOut;
+                presetFadePosition = 0;
+            }
+            else if (presetSnapshotActive && presetAppliedGeneration.load() == activeSnapshotGeneration)
+            {
+                // Live parameters now match the snapshot - hand control back to them
+                presetSnapshotActive = false;
+            }
+            return false;
+            
+        case PresetFadeStage::fadingOut:
+            // Hold the wet signal at silence until the snapshot can be read
+            if (presetFadePosition < presetFadeLength || ! applyPresetSnapshotTargets())
+                return false;
+            
+            presetSnapshotActive = true;
+            presetFadeStage = PresetFadeStage::fadingIn;
+            presetFadePosition = 0;
+            return true;
+            
+        case PresetFadeStage::fadingIn:
+            if (presetFadePosition >= presetFadeLength)
+                presetFadeStage = PresetFadeStage::idle;
+            return false;
+    }
     
-    // Step 4: Apply crosstalk mixing
-    applyCrosstalk (numSamples);
+    return false;
+}
+
+bool TapMatrixAudioProcessor::applyPresetSnapshotTargets()
+{
+    // Never block the audio thread - the message thread only holds this for a copy
+    const juce::SpinLock::ScopedTryLockType lock (presetSnapshotLock);
+    if (! lock.isLocked())
+        return false;
     
-    // Step 5: Apply panning to create wet signal in output buffer
-    buffer.clear();  // Clear before panning writes to it
-    applyPanning (buffer, numSamples);
+    for (int i = 0; i < NUM_TAPS; ++i)
+    {
+        tapControls[i].setTargets (presetSnapshot.data() + i * BinaryStateFormat::numTapParameters);
+        tapControls[i].inputSource = InputRouter::toSource (
+            presetSnapshot[static_cast<size_t> (BinaryStateFormat::getTapV2Index (NUM_TAPS, i, BinaryStateFormat::tapInputSource))]);
+        tapControls[i].setModulationTargets (
+            presetSnapshot.data() + BinaryStateFormat::getTapV3Index (NUM_TAPS, i, BinaryStateFormat::tapLfoShape));
+    }
     
-    // Step 6: Apply global HPF/LPF to wet signal
-    applyGlobalFilters (buffer, numSamples);
+    globalControls.setTargets (presetSnapshot.data() + BinaryStateFormat::getGlobalIndex (NUM_TAPS, BinaryStateFormat::globalMix));
+    activeSnapshotGeneration = presetSnapshotGeneration.load();
+    return true;
+}
+
+template <typename SampleType>
+void TapMatrixAudioProcessor::applyPresetFadeGain (juce::AudioBuffer<SampleType>& wetBuffer, int numSamples)
+{
+    if (presetFadeStage == PresetFadeStage::idle)
+        return;
     
-    // Step 7: Apply ducking to wet signal based on dry input
-    applyDucking (buffer, dryBuffer, numSamples);
+    const float startPos = static_cast<float> (presetFadePosition) / static_cast<float> (presetFadeLength);
+    presetFadePosition = juce::jmin (presetFadeLength, presetFadePosition + numSamples);
+    const float endPos = static_cast<float> (presetFadePosition) / static_cast<float> (presetFadeLength);
     
-    // Step 8: Mix dry and wet signals
-    applyDryWetMix (buffer, dryBuffer, buffer, numSamples);
+    if (presetFadeStage == PresetFadeStage::fadingOut)
+        wetBuffer.applyGainRamp (0, numSamples, static_cast<SampleType> (1.0f - startPos), static_cast<SampleType> (1.0f - endPos));
+    else
+        wetBuffer.applyGainRamp (0, numSamples, static_cast<SampleType> (startPos), static_cast<SampleType> (endPos));
+}
+
+void TapMatrixAudioProcessor::updateTapMeters()
+{
+    // Smooth the level with decay for visual appeal
+    const float attackCoeff = 0.8f;
+    const float releaseCoeff = 0.95f;
     
-    // Step 9: Apply output gain
-    float outputGainDb = parameters.getRawParameterValue ("outputGain")->load();
-    float outputGain = juce::Decibels::decibelsToGain (outputGainDb);
-    buffer.applyGain (outputGain);
+    forEachEngine ([=] (auto& engine)
+    {
+        for (auto& tap : engine.taps)
+        {
+            if (tap.meterSampleCount == 0)
+                continue;
+            
+            // RMS level for UI metering (pre-pan)
+            float rms = std::sqrt (tap.meterSumSquares / tap.meterSampleCount);
+            
+            float currentVal = tap.currentLevel.load();
+            float newVal = (rms > currentVal) ? (currentVal * attackCoeff + rms * (1.0f - attackCoeff))
+                                               : (currentVal * releaseCoeff);
+            tap.currentLevel.store (newVal);
+            
+            tap.meterSumSquares = 0.0f;
+            tap.meterSampleCount = 0;
+        }
+    });
 }
 
-void TapMatrixAudioProcessor::processTaps (const float* monoInput, int numSamples, double bpm)
+template <typename SampleType>
+void TapMatrixAudioProcessor::processTaps (EngineState<SampleType>& engine, int numSamples)
 {
-    tapOutputBuffer.clear();
+    auto& taps = engine.taps;
+    engine.tapOutputBuffer.clear (0, numSamples);
+    
+    const bool tapeMode = globalControls.tapeMode;
+    const bool linearInterpolation = loadGovernor.isActive (LoadGovernor::linearInterpolation);
+    const auto& saturationTable = TapeEngine::SaturationTable::getInstance();
+    
+    // While bypassed, track what is still in the delay lines (pre-gain) for silence detection
+    const bool trackTailPeak = bypassed;
+    SampleType tailPeak = 0;
+    
+    // Per-tap constants for this sub-block (structure-of-arrays so the sample loop can run across taps).
+    // Gains ramp from the previous control update's modulated value so LFO gain modulation doesn't zipper.
+    const float rampStart = getControlRampPosition (0);
+    const float rampEnd = getControlRampPosition (numSamples);
+    std::array<SampleType, NUM_TAPS> tapGains;
+    std::array<SampleType, NUM_TAPS> tapGainSteps;
+    std::array<SampleType, NUM_TAPS> tapFeedbacks;
+    std::array<SampleType*, NUM_TAPS> tapOutputs;
+    std::array<SampleType*, NUM_TAPS> delayLines;
+    std::array<const SampleType*, NUM_TAPS> tapInputs;
+    std::array<bool, NUM_TAPS> delayGlides;
     
-    // Check if reverb type has changed
-    int reverbTypeIndex = parameters.getRawParameterValue ("reverbType")->load();
-    auto newReverbType = static_cast<ReverbType> (reverbTypeIndex);
-    if (newReverbType != currentReverbType)
+    for (int tapIndex = 0; tapIndex < NUM_TAPS; ++tapIndex)
     {
-        currentReverbType = newReverbType;
-        updateReverbParameters();
+        const auto& controls = tapControls[tapIndex];
+        const float startGain = juce::jmap (rampStart, controls.previousModulatedGain, controls.modulatedGain);
+        const float endGain = juce::jmap (rampEnd, controls.previousModulatedGain, controls.modulatedGain);
+        tapGains[tapIndex] = static_cast<SampleType> (startGain);
+        tapGainSteps[tapIndex] = static_cast<SampleType> (endGain - startGain) / static_cast<SampleType> (numSamples);
+        tapFeedbacks[tapIndex] = static_cast<SampleType> (tapControls[tapIndex].feedback.getCurrentValue());
+        tapOutputs[tapIndex] = engine.tapOutputBuffer.getWritePointer (tapIndex);
+        delayLines[tapIndex] = taps[tapIndex].buffer.getWritePointer (0);
+        tapInputs[tapIndex] = inputRouter.getSource<SampleType> (tapControls[tapIndex].inputSource);
+        delayGlides[tapIndex] = tapeMode || tapControls[tapIndex].lfoDelayDepthMs > 0.0f;
     }
     
-    // Get tape mode setting
-    bool tapeMode = parameters.getRawParameterValue ("tapeMode")->load() > 0.5f;
+    // Delay lines - taps are interleaved per sample so the feedback damping
+    // filters of all taps update together in one SIMD step (float at either precision)
+    alignas (32) std::array<float, NUM_TAPS> feedbackSamples;
     
-    for (int tapIndex = 0; tapIndex < NUM_TAPS; ++tapIndex)
+    for (int i = 0; i < numSamples; ++i)
     {
-        auto& tap = taps[tapIndex];
-        auto* tapOutput = tapOutputBuffer.getWritePointer (tapIndex);
-        auto* delayData = tap.buffer.getWritePointer (0);
-        
-        // Get tap parameters
-        float gainDb = parameters.getRawParameterValue (getTapParamID ("gain", tapIndex))->load();
-        float gain = juce::Decibels::decibelsToGain (gainDb);
-        
-        // Check sync mode
-        bool useSyncMode = parameters.getRawParameterValue (getTapParamID ("syncMode", tapIndex))->load() > 0.5f;
-        float delayTimeMs;
-        
-        if (useSyncMode)
-        {
-            // SYNC mode: convert beats to milliseconds
-            float syncDelayBeats = parameters.getRawParameterValue (getTapParamID ("syncDelay", tapIndex))->load();
-            delayTimeMs = beatsToMs (syncDelayBeats, bpm);
-        }
-        else
-        {
-            // TIME mode: use direct millisecond value
-            delayTimeMs = parameters.getRawParameterValue (getTapParamID ("delayTime", tapIndex))->load();
-        }
-        
-        float feedback = parameters.getRawParameterValue (getTapParamID ("feedback", tapIndex))->load();
-        feedback = juce::jlimit (0.0f, 0.995f, feedback);  // Hard limit to prevent runaway
-        float damping = parameters.getRawParameterValue (getTapParamID ("damping", tapIndex))->load();
-        float reverbAmount = parameters.getRawParameterValue (getTapParamID ("reverb", tapIndex))->load();
-        
-        // Convert delay time to samples
-        tap.targetDelaySamples = (delayTimeMs / 1000.0f) * static_cast<float> (getSampleRate());
-        tap.targetDelaySamples = juce::jlimit (1.0f, static_cast<float> (tap.bufferLength - 4), tap.targetDelaySamples);
-        
-        // Initialize current delay on first run
-        if (tap.currentDelaySamples == 0.0f)
-            tap.currentDelaySamples = tap.targetDelaySamples;
-        
-        // Update damping coefficient (1.0 = no damping, 0.0 = full damping)
-        tap.dampingCoeff = 1.0f - damping;
-        
-        int localWritePos = tap.writePosition;
-        
-        for (int i = 0; i < numSamples; ++i)
+        for (int tapIndex = 0; tapIndex < NUM_TAPS; ++tapIndex)
         {
-            // Tape mode: smoothly interpolate delay time to avoid clicks/glitches
-            if (tapeMode)
+            auto& tap = taps[tapIndex];
+            const auto* delayData = delayLines[tapIndex];
+            const int mask = tap.bufferMask;
+            float readDelay;
+            
+            // Tape mode (and LFO-modulated delay times): glide the read head (speed-limited,
+            // so large jumps bend pitch like a tape speed change). Tape mode adds per-tap wow/flutter.
+            if (delayGlides[tapIndex])
             {
-                // Smooth delay time changes over approximately 10ms (correct exponential formula)
-                float smoothingCoeff = 1.0f - std::exp (-1.0f / (0.010f * static_cast<float> (getSampleRate())));
-                tap.currentDelaySamples += smoothingCoeff * (tap.targetDelaySamples - tap.currentDelaySamples);
+                float glide = tapeCoeffs.smoothingCoeff * (tap.targetDelaySamples - tap.currentDelaySamples);
+                tap.currentDelaySamples += juce::jlimit (-tapeCoeffs.maxSlewSamples, tapeCoeffs.maxSlewSamples, glide);
+                
+                readDelay = tap.currentDelaySamples;
+                if (tapeMode)
+                {
+                    readDelay += tapeCoeffs.wowDepthSamples * tap.tape.wow.advance()
+                               + tapeCoeffs.flutterDepthSamples * tap.tape.flutter.advance();
+                }
+                readDelay = juce::jlimit (1.0f, static_cast<float> (tap.bufferLength - 4), readDelay);
             }
             else
             {
                 // No tape mode: instant delay time changes (can cause clicks)
                 tap.currentDelaySamples = tap.targetDelaySamples;
+                readDelay = tap.currentDelaySamples;
             }
             
             // Calculate read position using current smoothed delay time
-            float readPos = localWritePos - tap.currentDelaySamples;
-            if (readPos < 0.0f)
-                readPos += tap.bufferLength;
+            SampleType readPos = static_cast<SampleType> (tap.writePosition) - static_cast<SampleType> (readDelay);
+            if (readPos < 0)
+                readPos += static_cast<SampleType> (tap.bufferLength);
+            
+            // Cubic interpolation for higher quality (reduces aliasing artifacts);
+            // linear when the load governor has stepped down
+            int readIndex1 = static_cast<int> (readPos) & mask;
+            int readIndex2 = (readIndex1 + 1) & mask;
+            SampleType frac = readPos - std::floor (readPos);
+            SampleType delayedSample;
+            
+            if (linearInterpolation)
+            {
+                delayedSample = delayData[readIndex1] + frac * (delayData[readIndex2] - delayData[readIndex1]);
+            }
+            else
+            {
+                int readIndex0 = (readIndex1 - 1) & mask;
+                int readIndex3 = (readIndex1 + 2) & mask;
+                delayedSample = cubicInterpolate (delayData[readIndex0], delayData[readIndex1],
+                                                  delayData[readIndex2], delayData[readIndex3], frac);
+            }
             
-            // Cubic interpolation for higher quality (reduces aliasing artifacts)
-            int readIndex0 = (static_cast<int> (readPos) - 1 + tap.bufferLength) % tap.bufferLength;
-            int readIndex1 = static_cast<int> (readPos);
-            int readIndex2 = (readIndex1 + 1) % tap.bufferLength;
-            int readIndex3 = (readIndex1 + 2) % tap.bufferLength;
-            float frac = readPos - std::floor (readPos);
+            if (trackTailPeak)
+                tailPeak = juce::jmax (tailPeak, std::abs (delayedSample));
             
-            float y0 = delayData[readIndex0];
-            float y1 = delayData[readIndex1];
-            float y2 = delayData[readIndex2];
-            float y3 = delayData[readIndex3];
+            // Output delayed sample with gain (dry delay signal)
+            tapOutputs[tapIndex][i] = delayedSample * (tapGains[tapIndex] + tapGainSteps[tapIndex] * static_cast<SampleType> (i + 1));
             
-            float delayedSample = cubicInterpolate (y0, y1, y2, y3, frac);
+            // Feedback does NOT include reverb
+            feedbackSamples[tapIndex] = static_cast<float> (delayedSample * tapFeedbacks[tapIndex]);
+        }
+        
+        // Damping filter in the feedback loop (spec 8.3) - all taps at once
+        dampingFilters.process (feedbackSamples.data());
+        
+        for (int tapIndex = 0; tapIndex < NUM_TAPS; ++tapIndex)
+        {
+            auto& tap = taps[tapIndex];
+            float dampedFeedback = feedbackSamples[tapIndex];
             
-            // Apply damping to feedback (feedback does NOT include reverb)
-            float dampedFeedback = delayedSample * tap.dampingCoeff;
+            // Tape saturation on the feedback path (unity gain for small signals)
+            if (tapeCoeffs.saturate)
+                dampedFeedback = saturationTable.process (dampedFeedback * tapeCoeffs.saturationDrive) * tapeCoeffs.saturationMakeup;
             
             // Write to delay buffer with feedback (with safety clipping and denormal flush)
-            float newSample = monoInput[i] + (dampedFeedback * feedback);
-            newSample = juce::jlimit (-1.5f, 1.5f, newSample);  // Prevent runaway
+            SampleType newSample = tapInputs[tapIndex][i] + static_cast<SampleType> (dampedFeedback);
+            newSample = juce::jlimit (static_cast<SampleType> (-1.5), static_cast<SampleType> (1.5), newSample);  // Prevent runaway
             // Flush denormals to zero for CPU efficiency
             if (std::fpclassify (newSample) == FP_SUBNORMAL)
-                newSample = 0.0f;
-            delayData[localWritePos] = newSample;
-            
-            // Output delayed sample with gain (dry delay signal)
-            tapOutput[i] = delayedSample * gain;
+                newSample = 0;
+            delayLines[tapIndex][tap.writePosition] = newSample;
             
             // Advance write position
-            localWritePos = (localWritePos + 1) % tap.bufferLength;
+            tap.writePosition = (tap.writePosition + 1) & tap.bufferMask;
         }
+    }
+    
+    if (tapeMode)
+    {
+        for (auto& tap : taps)
+        {
+            tap.tape.wow.renormalise();
+            tap.tape.flutter.renormalise();
+        }
+    }
+    
+    bypassTailPeak = static_cast<float> (tailPeak);
+    
+    // Reverb is applied POST-delay, PRE-panning
+    // The spec says: "Reverb is not included in feedback or crosstalk"
+    processTapReverbs (engine, numSamples);
+    
+    for (int tapIndex = 0; tapIndex < NUM_TAPS; ++tapIndex)
+    {
+        auto& tap = taps[tapIndex];
+        auto* tapOutput = tapOutputs[tapIndex];
         
-        tap.writePosition = localWritePos;
+        // Accumulate energy for UI metering (pre-pan), published once per host block
+        SampleType sumSquares = 0;
+        for (int i = 0; i < numSamples; ++i)
+            sumSquares += tapOutput[i] * tapOutput[i];
+        tap.meterSumSquares += static_cast<float> (sumSquares);
+        tap.meterSampleCount += numSamples;
+        
+        tap.lastOutputSample = tapOutput[numSamples - 1];
+    }
+}
+
+template <typename SampleType>
+void TapMatrixAudioProcessor::processTapReverbs (EngineState<SampleType>& engine, int numSamples)
+{
+    // Under load, neighbouring taps (1+2, 3+4, ...) share the first tap's reverb and
+    // inactive taps skip theirs. Each tap still blends the wet signal with its own amount.
+    const bool shareReverbs = loadGovernor.isActive (LoadGovernor::sharedReverbs);
+    const bool skipInactive = loadGovernor.isActive (LoadGovernor::inactiveTapReverbOff);
+    const int groupSize = shareReverbs ? 2 : 1;
+    
+    std::array<bool, NUM_TAPS> reverbsRunning {};
+    
+    for (int firstTap = 0; firstTap < NUM_TAPS; firstTap += groupSize)
+    {
+        std::array<bool, 2> sends {};
+        bool anySends = false;
         
-        // Apply reverb to tap output if reverb amount > 0
-        // Reverb is applied POST-delay, PRE-panning
-        // The spec says: "Reverb is not included in feedback or crosstalk"
-        if (reverbAmount > 0.001f)
+        for (int member = 0; member < groupSize; ++member)
         {
-            // Create a copy of the dry delay signal for reverb processing
-            juce::AudioBuffer<float> reverbBuffer (1, numSamples);
-            reverbBuffer.copyFrom (0, 0, tapOutput, numSamples);
-            
-            // Process reverb on the copy
-            juce::dsp::AudioBlock<float> block (reverbBuffer);
-            juce::dsp::ProcessContextReplacing<float> context (block);
-            tap.reverb.process (context);
+            const int tapIndex = firstTap + member;
+            if (tapControls[tapIndex].modulatedReverb <= 0.001f
+                || (skipInactive && isTapInactive (tapIndex)))
+                continue;
             
-            // Blend dry delay with wet reverb
-            // tapOutput = (1 - reverbAmount) * dry + reverbAmount * wet
-            float dryGain = 1.0f - reverbAmount;
+            // Sum the dry delay signals into pre-allocated scratch for reverb processing
+            if (! anySends)
+                reverbBuffer.clear (0, 0, numSamples);
             
-            for (int i = 0; i < numSamples; ++i)
-                tapOutput[i] = tapOutput[i] * dryGain + reverbBuffer.getSample (0, i) * reverbAmount;
+            addConverted (reverbBuffer.getWritePointer (0), engine.tapOutputBuffer.getReadPointer (tapIndex),
+                          1.0f / static_cast<float> (groupSize), numSamples);
+            sends[static_cast<size_t> (member)] = true;
+            anySends = true;
         }
         
-        // Calculate RMS level for UI metering (pre-pan)
-        float sumSquares = 0.0f;
-        for (int i = 0; i < numSamples; ++i)
-            sumSquares += tapOutput[i] * tapOutput[i];
-        float rms = std::sqrt (sumSquares / numSamples);
+        if (! anySends)
+            continue;
+        
+        juce::dsp::AudioBlock<float> block (reverbBuffer.getArrayOfWritePointers(), 1, static_cast<size_t> (numSamples));
+        juce::dsp::ProcessContextReplacing<float> context (block);
+        engine.taps[firstTap].reverb.process (context);
+        reverbsRunning[static_cast<size_t> (firstTap)] = true;
         
-        // Smooth the level with decay for visual appeal
-        const float attackCoeff = 0.8f;
-        const float releaseCoeff = 0.95f;
-        float currentVal = tap.currentLevel.load();
-        float newVal = (rms > currentVal) ? (currentVal * attackCoeff + rms * (1.0f - attackCoeff))
-                                           : (currentVal * releaseCoeff);
-        tap.currentLevel.store (newVal);
+        if (bypassed)
+            bypassTailPeak = juce::jmax (bypassTailPeak, reverbBuffer.getMagnitude (0, 0, numSamples));
         
-        tap.lastOutputSample = tapOutput[numSamples - 1];
+        for (int member = 0; member < groupSize; ++member)
+        {
+            if (! sends[static_cast<size_t> (member)])
+                continue;
+            
+            // Blend dry delay with wet reverb
+            // tapOutput = (1 - reverbAmount) * dry + reverbAmount * wet
+            const int tapIndex = firstTap + member;
+            const float reverbAmount = tapControls[tapIndex].modulatedReverb;
+            auto* tapOutput = engine.tapOutputBuffer.getWritePointer (tapIndex);
+            
+            juce::FloatVectorOperations::multiply (tapOutput, static_cast<SampleType> (1.0f - reverbAmount), numSamples);
+            addConverted (tapOutput, reverbBuffer.getReadPointer (0), reverbAmount, numSamples);
+        }
+    }
+    
+    // A reverb that stops running (skipped, unused while sharing, or no send) would
+    // resume later with a stale tail, so it restarts from silence instead
+    for (int tapIndex = 0; tapIndex < NUM_TAPS; ++tapIndex)
+    {
+        const auto index = static_cast<size_t> (tapIndex);
+        if (tapReverbsRunning[index] && ! reverbsRunning[index])
+            engine.taps[tapIndex].reverb.reset();
     }
+    
+    tapReverbsRunning = reverbsRunning;
+}
+
+bool TapMatrixAudioProcessor::isTapInactive (int tapIndex) const
+{
+    // Only muted taps: a quiet delay line can still feed a ringing reverb, and its
+    // input comes back on the next echo
+    return tapControls[tapIndex].modulatedGain < INACTIVE_TAP_GAIN;
 }
 
-void TapMatrixAudioProcessor::applyCrosstalk (int numSamples)
+template <typename SampleType>
+void TapMatrixAudioProcessor::applyCrosstalk (EngineState<SampleType>& engine, int numSamples)
 {
+    auto& tapOutputBuffer = engine.tapOutputBuffer;
+    auto& crosstalkBuffer = engine.crosstalkBuffer;
+    
     // Use pre-allocated member buffer (no malloc on audio thread)
-    crosstalkBuffer.clear();
+    crosstalkBuffer.clear (0, numSamples);
     
     // Calculate crosstalk for each tap
     for (int destTap = 0; destTap < NUM_TAPS; ++destTap)
@@ -614,9 +1429,9 @@ void TapMatrixAudioProcessor::applyCrosstalk (int numSamples)
             if (srcTap == destTap)
                 continue;  // No self-crosstalk
             
-            float crosstalkAmount = parameters.getRawParameterValue (getTapParamID ("crosstalk", srcTap))->load();
+            const auto crosstalkAmount = static_cast<SampleType> (tapControls[srcTap].crosstalk.getCurrentValue());
             
-            if (crosstalkAmount > 0.0f)
+            if (crosstalkAmount > 0)
             {
                 auto* srcBuffer = tapOutputBuffer.getReadPointer (srcTap);
                 
@@ -631,85 +1446,123 @@ void TapMatrixAudioProcessor::applyCrosstalk (int numSamples)
         tapOutputBuffer.addFrom (tap, 0, crosstalkBuffer, tap, 0, numSamples);
 }
 
-void TapMatrixAudioProcessor::applyPanning (juce::AudioBuffer<float>& outputBuffer, int numSamples)
+template <typename SampleType>
+void TapMatrixAudioProcessor::applyPanning (const EngineState<SampleType>& engine,
+                                            juce::AudioBuffer<SampleType>& outputBuffer, int numSamples)
 {
-    outputBuffer.clear();
+    outputBuffer.clear (0, numSamples);
     
     const int numOutputChannels = outputBuffer.getNumChannels();
     
     for (int tapIndex = 0; tapIndex < NUM_TAPS; ++tapIndex)
     {
+        auto* tapInput = engine.tapOutputBuffer.getReadPointer (tapIndex);
+        
         // Route based on output channel count
         if (numOutputChannels == 1)
         {
             // Mono output - sum all taps to center
-            auto* tapInput = tapOutputBuffer.getReadPointer (tapIndex);
             outputBuffer.addFrom (0, 0, tapInput, numSamples);
         }
         else if (numOutputChannels == 2)
         {
             // Stereo output - use X panning
-            panTapToStereo (tapIndex, outputBuffer.getWritePointer (0), 
+            panTapToStereo (tapIndex, tapInput, outputBuffer.getWritePointer (0), 
                            outputBuffer.getWritePointer (1), numSamples);
         }
         else if (numOutputChannels == 6)
         {
             // 5.1 surround
-            panTapTo51 (tapIndex, outputBuffer, numSamples);
+            panTapTo51 (tapIndex, tapInput, outputBuffer, numSamples);
         }
         else if (numOutputChannels == 8)
         {
             // 7.1 surround
-            panTapTo71 (tapIndex, outputBuffer, numSamples);
+            panTapTo71 (tapIndex, tapInput, outputBuffer, numSamples);
         }
         else
         {
             // Multi-mono or other formats - distribute evenly
-            auto* tapInput = tapOutputBuffer.getReadPointer (tapIndex);
             for (int ch = 0; ch < numOutputChannels; ++ch)
-                outputBuffer.addFrom (ch, 0, tapInput, numSamples, 1.0f / numOutputChannels);
+                outputBuffer.addFrom (ch, 0, tapInput, numSamples, static_cast<SampleType> (1) / numOutputChannels);
         }
     }
 }
 
-void TapMatrixAudioProcessor::panTapToStereo (int tapIndex, float* leftOut, float* rightOut, int numSamples)
+template <typename SampleType>
+void TapMatrixAudioProcessor::panTapToStereo (int tapIndex, const SampleType* tapInput,
+                                              SampleType* leftOut, SampleType* rightOut, int numSamples)
 {
-    auto* tapInput = tapOutputBuffer.getReadPointer (tapIndex);
-    float panX = parameters.getRawParameterValue (getTapParamID ("panX", tapIndex))->load();
+    const auto& controls = tapControls[tapIndex];
     
-    // Constant power pan law: L = cos(θ), R = sin(θ)
-    // panX ranges from -1 (left) to +1 (right)
-    float panAngle = (panX + 1.0f) * 0.25f * juce::MathConstants<float>::pi; // 0 to π/2
-    float leftGain = std::cos (panAngle);
-    float rightGain = std::sin (panAngle);
+    // Ramp from the previous control update's pan so LFO pan modulation doesn't zipper
+    const float rampStart = getControlRampPosition (0);
+    const float rampEnd = getControlRampPosition (numSamples);
+    const auto startGains = getStereoPanGains (static_cast<SampleType> (juce::jmap (rampStart, controls.previousModulatedPanX, controls.modulatedPanX)));
+    const auto endGains = getStereoPanGains (static_cast<SampleType> (juce::jmap (rampEnd, controls.previousModulatedPanX, controls.modulatedPanX)));
     
-    for (int i = 0; i < numSamples; ++i)
-    {
-        leftOut[i] += tapInput[i] * leftGain;
-        rightOut[i] += tapInput[i] * rightGain;
-    }
+    addWithGainRamp (leftOut, tapInput, startGains[0], endGains[0], numSamples);
+    addWithGainRamp (rightOut, tapInput, startGains[1], endGains[1], numSamples);
+}
+
+template <typename SampleType>
+void TapMatrixAudioProcessor::panTapTo51 (int tapIndex, const SampleType* tapInput,
+                                          juce::AudioBuffer<SampleType>& outputBuffer, int numSamples)
+{
+    const auto& controls = tapControls[tapIndex];
+    
+    const float rampStart = getControlRampPosition (0);
+    const float rampEnd = getControlRampPosition (numSamples);
+    const auto startGains = get51PanGains (static_cast<SampleType> (juce::jmap (rampStart, controls.previousModulatedPanX, controls.modulatedPanX)),
+                                           static_cast<SampleType> (juce::jmap (rampStart, controls.previousModulatedPanY, controls.modulatedPanY)));
+    const auto endGains = get51PanGains (static_cast<SampleType> (juce::jmap (rampEnd, controls.previousModulatedPanX, controls.modulatedPanX)),
+                                         static_cast<SampleType> (juce::jmap (rampEnd, controls.previousModulatedPanY, controls.modulatedPanY)));
+    
+    for (int ch = 0; ch < 6; ++ch)
+        addWithGainRamp (outputBuffer.getWritePointer (ch), tapInput, startGains[(size_t) ch], endGains[(size_t) ch], numSamples);
 }
 
-void TapMatrixAudioProcessor::panTapTo51 (int tapIndex, juce::AudioBuffer<float>& outputBuffer, int numSamples)
+template <typename SampleType>
+void TapMatrixAudioProcessor::panTapTo71 (int tapIndex, const SampleType* tapInput,
+                                          juce::AudioBuffer<SampleType>& outputBuffer, int numSamples)
 {
-    auto* tapInput = tapOutputBuffer.getReadPointer (tapIndex);
+    const auto& controls = tapControls[tapIndex];
     
-    // Get pan coordinates
-    float panX = parameters.getRawParameterValue (getTapParamID ("panX", tapIndex))->load();  // -1 to +1 (L/R)
-    float panY = parameters.getRawParameterValue (getTapParamID ("panY", tapIndex))->load();  // -1 to +1 (F/B)
+    const float rampStart = getControlRampPosition (0);
+    const float rampEnd = getControlRampPosition (numSamples);
+    const auto startGains = get71PanGains (static_cast<SampleType> (juce::jmap (rampStart, controls.previousModulatedPanX, controls.modulatedPanX)),
+                                           static_cast<SampleType> (juce::jmap (rampStart, controls.previousModulatedPanY, controls.modulatedPanY)));
+    const auto endGains = get71PanGains (static_cast<SampleType> (juce::jmap (rampEnd, controls.previousModulatedPanX, controls.modulatedPanX)),
+                                         static_cast<SampleType> (juce::jmap (rampEnd, controls.previousModulatedPanY, controls.modulatedPanY)));
     
+    for (int ch = 0; ch < 8; ++ch)
+        addWithGainRamp (outputBuffer.getWritePointer (ch), tapInput, startGains[(size_t) ch], endGains[(size_t) ch], numSamples);
+}
+
+template <typename SampleType>
+std::array<SampleType, 2> TapMatrixAudioProcessor::getStereoPanGains (SampleType panX)
+{
+    // Constant power pan law: L = cos(θ), R = sin(θ)
+    // panX ranges from -1 (left) to +1 (right)
+    SampleType panAngle = (panX + 1.0f) * 0.25f * juce::MathConstants<SampleType>::pi; // 0 to π/2
+    return { std::cos (panAngle), std::sin (panAngle) };
+}
+
+template <typename SampleType>
+std::array<SampleType, 6> TapMatrixAudioProcessor::get51PanGains (SampleType panX, SampleType panY)
+{
     // 5.1 speaker layout: L(0), R(1), C(2), LFE(3), Ls(4), Rs(5)
     // Normalize X,Y to 0-1 range
-    float x = (panX + 1.0f) * 0.5f; // 0 = left, 1 = right
-    float y = (panY + 1.0f) * 0.5f; // 0 = front, 1 = back
+    SampleType x = (panX + 1.0f) * 0.5f; // 0 = left, 1 = right
+    SampleType y = (panY + 1.0f) * 0.5f; // 0 = front, 1 = back
     
     // Calculate gains for each speaker
-    float gainL = 0.0f, gainR = 0.0f, gainC = 0.0f, gainLs = 0.0f, gainRs = 0.0f;
+    SampleType gainL = 0, gainR = 0, gainC = 0, gainLs = 0, gainRs = 0;
     
     if (y < 0.5f)
     {
         // Front hemisphere
-        float frontAmount = 1.0f - (y * 2.0f);
+        SampleType frontAmount = 1.0f - (y * 2.0f);
         
         if (x < 0.33f)
         {
@@ -720,7 +1573,7 @@ void TapMatrixAudioProcessor::panTapTo51 (int tapIndex, juce::AudioBuffer<float>
         else if (x < 0.66f)
         {
             // Center front
-            float centerX = (x - 0.33f) * 3.0f;
+            SampleType centerX = (x - 0.33f) * 3.0f;
             gainC = frontAmount * (1.0f - centerX);
             gainR = frontAmount * centerX;
         }
@@ -733,42 +1586,27 @@ void TapMatrixAudioProcessor::panTapTo51 (int tapIndex, juce::AudioBuffer<float>
     }
     
     // Surround speakers (back hemisphere)
-    float backAmount = y;
+    SampleType backAmount = y;
     gainLs = backAmount * (1.0f - x);
     gainRs = backAmount * x;
     
-    // Apply gains
-    for (int i = 0; i < numSamples; ++i)
-    {
-        float sample = tapInput[i];
-        outputBuffer.getWritePointer(0)[i] += sample * gainL;   // L
-        outputBuffer.getWritePointer(1)[i] += sample * gainR;   // R
-        outputBuffer.getWritePointer(2)[i] += sample * gainC;   // C
-        // Skip LFE (3)
-        outputBuffer.getWritePointer(4)[i] += sample * gainLs;  // Ls
-        outputBuffer.getWritePointer(5)[i] += sample * gainRs;  // Rs
-    }
+    return { gainL, gainR, gainC, 0 /* LFE */, gainLs, gainRs };
 }
 
-void TapMatrixAudioProcessor::panTapTo71 (int tapIndex, juce::AudioBuffer<float>& outputBuffer, int numSamples)
+template <typename SampleType>
+std::array<SampleType, 8> TapMatrixAudioProcessor::get71PanGains (SampleType panX, SampleType panY)
 {
-    auto* tapInput = tapOutputBuffer.getReadPointer (tapIndex);
-    
-    // Get pan coordinates
-    float panX = parameters.getRawParameterValue (getTapParamID ("panX", tapIndex))->load();
-    float panY = parameters.getRawParameterValue (getTapParamID ("panY", tapIndex))->load();
-    
     // 7.1 speaker layout: L(0), R(1), C(2), LFE(3), Ls(4), Rs(5), Lrs(6), Rrs(7)
-    float x = (panX + 1.0f) * 0.5f;
-    float y = (panY + 1.0f) * 0.5f;
+    SampleType x = (panX + 1.0f) * 0.5f;
+    SampleType y = (panY + 1.0f) * 0.5f;
     
-    float gainL = 0.0f, gainR = 0.0f, gainC = 0.0f;
-    float gainLs = 0.0f, gainRs = 0.0f, gainLrs = 0.0f, gainRrs = 0.0f;
+    SampleType gainL = 0, gainR = 0, gainC = 0;
+    SampleType gainLs = 0, gainRs = 0, gainLrs = 0, gainRrs = 0;
     
     // Front speakers (similar to 5.1)
     if (y < 0.5f)
     {
-        float frontAmount = 1.0f - (y * 2.0f);
+        SampleType frontAmount = 1.0f - (y * 2.0f);
         
         if (x < 0.33f)
         {
@@ -777,7 +1615,7 @@ void TapMatrixAudioProcessor::panTapTo71 (int tapIndex, juce::AudioBuffer<float>
         }
         else if (x < 0.66f)
         {
-            float centerX = (x - 0.33f) * 3.0f;
+            SampleType centerX = (x - 0.33f) * 3.0f;
             gainC = frontAmount * (1.0f - centerX);
             gainR = frontAmount * centerX;
         }
@@ -789,12 +1627,12 @@ void TapMatrixAudioProcessor::panTapTo71 (int tapIndex, juce::AudioBuffer<float>
     }
     
     // Surround speakers (split between side and rear)
-    float backAmount = y;
+    SampleType backAmount = y;
     
     if (y < 0.75f)
     {
         // Side surrounds
-        float sideAmount = backAmount * (1.0f - ((y - 0.5f) * 4.0f));
+        SampleType sideAmount = backAmount * (1.0f - ((y - 0.5f) * 4.0f));
         gainLs = sideAmount * (1.0f - x);
         gainRs = sideAmount * x;
     }
@@ -802,23 +1640,43 @@ void TapMatrixAudioProcessor::panTapTo71 (int tapIndex, juce::AudioBuffer<float>
     if (y > 0.5f)
     {
         // Rear surrounds
-        float rearAmount = (y - 0.5f) * 2.0f;
+        SampleType rearAmount = (y - 0.5f) * 2.0f;
         gainLrs = rearAmount * (1.0f - x);
         gainRrs = rearAmount * x;
     }
     
-    // Apply gains
+    return { gainL, gainR, gainC, 0 /* LFE */, gainLs, gainRs, gainLrs, gainRrs };
+}
+
+template <typename SampleType>
+void TapMatrixAudioProcessor::addWithGainRamp (SampleType* dest, const SampleType* source,
+                                               SampleType startGain, SampleType endGain, int numSamples)
+{
+    if (startGain == endGain)
+    {
+        if (endGain != 0)
+            juce::FloatVectorOperations::addWithMultiply (dest, source, endGain, numSamples);
+        return;
+    }
+    
+    // Reaches endGain on the last sample, like AudioBuffer::applyGainRamp
+    const SampleType step = (endGain - startGain) / static_cast<SampleType> (numSamples);
     for (int i = 0; i < numSamples; ++i)
+        dest[i] += source[i] * (startGain + step * static_cast<SampleType> (i + 1));
+}
+
+template <typename DestType, typename SourceType>
+void TapMatrixAudioProcessor::addConverted (DestType* dest, const SourceType* source, float gain, int numSamples)
+{
+    if constexpr (std::is_same_v<DestType, SourceType>)
+    {
+        juce::FloatVectorOperations::addWithMultiply (dest, source, static_cast<DestType> (gain), numSamples);
+    }
+    else
     {
-        float sample = tapInput[i];
-        outputBuffer.getWritePointer(0)[i] += sample * gainL;    // L
-        outputBuffer.getWritePointer(1)[i] += sample * gainR;    // R
-        outputBuffer.getWritePointer(2)[i] += sample * gainC;    // C
-        // Skip LFE (3)
-        outputBuffer.getWritePointer(4)[i] += sample * gainLs;   // Ls (side left)
-        outputBuffer.getWritePointer(5)[i] += sample * gainRs;   // Rs (side right)
-        outputBuffer.getWritePointer(6)[i] += sample * gainLrs;  // Lrs (rear left)
-        outputBuffer.getWritePointer(7)[i] += sample * gainRrs;  // Rrs (rear right)
+        const auto destGain = static_cast<DestType> (gain);
+        for (int i = 0; i < numSamples; ++i)
+            dest[i] += static_cast<DestType> (source[i]) * destGain;
     }
 }
 
@@ -836,17 +1694,40 @@ juce::AudioProcessorEditor* TapMatrixAudioProcessor::createEditor()
 //==============================================================================
 void TapMatrixAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
 {
-    auto state = parameters.copyState();
-    
-    // Add UI state to the saved state
-    state.setProperty ("uiScaleFactor", uiScaleFactor, nullptr);
-    
-    std::unique_ptr<juce::XmlElement> xml (state.createXml());
-    copyXmlToBinary (*xml, destData);
+    // Compact binary state: versioned header + packed values keyed by stable parameter index
+    BinaryStateFormat::write (destData, stateParameters.size(), uiScaleFactor, [this] (int index)
+    {
+        auto* param = stateParameters.getUnchecked (index);
+        return param->convertFrom0to1 (param->getValue());
+    });
 }
 
 void TapMatrixAudioProcessor::setStateInformation (const void* data, int sizeInBytes)
 {
+    BinaryStateFormat::ParsedState binaryState;
+    
+    if (BinaryStateFormat::parse (data, sizeInBytes, binaryState))
+    {
+        // Restore UI state
+        if (std::isfinite (binaryState.uiScaleFactor))
+            setUIScaleFactor (binaryState.uiScaleFactor);
+        
+        // Parameters newer than the saved state fall back to their defaults;
+        // values from newer states beyond what this build knows are ignored.
+        // Corrupt (non-finite) values also fall back, so they never reach the host.
+        for (int i = 0; i < stateParameters.size(); ++i)
+        {
+            auto* param = stateParameters.getUnchecked (i);
+            const float value = (i < binaryState.numValues) ? binaryState.getValue (i) : 0.0f;
+            float normalisedValue = (i < binaryState.numValues && std::isfinite (value)) ? param->convertTo0to1 (value)
+                                                                                         : param->getDefaultValue();
+            param->setValueNotifyingHost (normalisedValue);
+        }
+        
+        return;
+    }
+    
+    // Fallback: legacy XML state (sessions saved before the binary format)
     std::unique_ptr<juce::XmlElement> xmlState (getXmlFromBinary (data, sizeInBytes));
     
     if (xmlState.get() != nullptr)
@@ -873,8 +1754,11 @@ void TapMatrixAudioProcessor::updateReverbParameters()
     auto params = getReverbPreset (currentReverbType);
     
     // Apply the same reverb parameters to all tap reverb instances
-    for (auto& tap : taps)
-        tap.reverb.setParameters (params);
+    forEachEngine ([&params] (auto& engine)
+    {
+        for (auto& tap : engine.taps)
+            tap.reverb.setParameters (params);
+    });
 }
 
 juce::dsp::Reverb::Parameters TapMatrixAudioProcessor::getReverbPreset (ReverbType type) const
@@ -936,21 +1820,13 @@ juce::dsp::Reverb::Parameters TapMatrixAudioProcessor::getReverbPreset (ReverbTy
 // Global Processing Chain
 //==============================================================================
 
-void TapMatrixAudioProcessor::applyGlobalFilters (juce::AudioBuffer<float>& buffer, int numSamples)
+template <typename SampleType>
+void TapMatrixAudioProcessor::applyGlobalFilters (EngineState<SampleType>& engine,
+                                                  juce::AudioBuffer<SampleType>& buffer, int numSamples)
 {
     const int numChannels = buffer.getNumChannels();
     
-    // Get filter frequencies (clamp to Nyquist to prevent instability)
-    float nyquist = static_cast<float> (getSampleRate()) * 0.49f;  // 2% headroom
-    float hpfFreq = juce::jmin (parameters.getRawParameterValue ("hpfFreq")->load(), nyquist);
-    float lpfFreq = juce::jmin (parameters.getRawParameterValue ("lpfFreq")->load(), nyquist);
-    
-    // Update filter cutoffs
-    for (int ch = 0; ch < juce::jmin (numChannels, MAX_CHANNELS); ++ch)
-    {
-        hpFilters[ch].setCutoffFrequency (hpfFreq);
-        lpFilters[ch].setCutoffFrequency (lpfFreq);
-    }
+    // Filter cutoffs are updated at control rate (see updateControlState)
     
     // Process each channel through HPF then LPF
     for (int ch = 0; ch < juce::jmin (numChannels, MAX_CHANNELS); ++ch)
@@ -958,22 +1834,23 @@ void TapMatrixAudioProcessor::applyGlobalFilters (juce::AudioBuffer<float>& buff
         auto* channelData = buffer.getWritePointer (ch);
         
         // Create audio block for this channel
-        juce::dsp::AudioBlock<float> block (&channelData, 1, 0, numSamples);
-        juce::dsp::ProcessContextReplacing<float> context (block);
+        juce::dsp::AudioBlock<SampleType> block (&channelData, 1, 0, static_cast<size_t> (numSamples));
+        juce::dsp::ProcessContextReplacing<SampleType> context (block);
         
         // Apply HPF
-        hpFilters[ch].process (context);
+        engine.hpFilters[ch].process (context);
         
         // Apply LPF
-        lpFilters[ch].process (context);
+        engine.lpFilters[ch].process (context);
     }
 }
 
-void TapMatrixAudioProcessor::applyDucking (juce::AudioBuffer<float>& wetBuffer, 
-                                           const juce::AudioBuffer<float>& dryBuffer, 
+template <typename SampleType>
+void TapMatrixAudioProcessor::applyDucking (juce::AudioBuffer<SampleType>& wetBuffer, 
+                                           const juce::AudioBuffer<SampleType>& dryBuffer, 
                                            int numSamples)
 {
-    float duckingDb = parameters.getRawParameterValue ("ducking")->load();
+    float duckingDb = globalControls.ducking.getCurrentValue();
     
     // Skip if ducking is disabled
     if (duckingDb < 0.1f)
@@ -982,9 +1859,9 @@ void TapMatrixAudioProcessor::applyDucking (juce::AudioBuffer<float>& wetBuffer,
     // Convert dB to linear reduction amount (0-12dB -> 0.0-1.0)
     float duckAmount = duckingDb / 12.0f;
     
-    // Envelope follower parameters
-    const float attackCoeff = 1.0f - std::exp (-1.0f / (0.001f * static_cast<float> (getSampleRate())));  // 1ms attack
-    const float releaseCoeff = 1.0f - std::exp (-1.0f / (0.050f * static_cast<float> (getSampleRate()))); // 50ms release
+    // Envelope follower coefficients (computed in prepareToPlay)
+    const float attackCoeff = duckingAttackCoeff;
+    const float releaseCoeff = duckingReleaseCoeff;
     
     const int numChannels = wetBuffer.getNumChannels();
     
@@ -994,7 +1871,7 @@ void TapMatrixAudioProcessor::applyDucking (juce::AudioBuffer<float>& wetBuffer,
         float dryEnergySq = 0.0f;
         for (int ch = 0; ch < juce::jmin (dryBuffer.getNumChannels(), MAX_CHANNELS); ++ch)
         {
-            float sample = dryBuffer.getSample (ch, i);
+            float sample = static_cast<float> (dryBuffer.getSample (ch, i));
             dryEnergySq += sample * sample;
         }
         dryEnergySq = dryEnergySq / juce::jmax (1, dryBuffer.getNumChannels());
@@ -1012,16 +1889,18 @@ void TapMatrixAudioProcessor::applyDucking (juce::AudioBuffer<float>& wetBuffer,
         
         // Apply ducking to all wet channels
         for (int ch = 0; ch < juce::jmin (numChannels, MAX_CHANNELS); ++ch)
-            wetBuffer.setSample (ch, i, wetBuffer.getSample (ch, i) * duckingGain);
+            wetBuffer.setSample (ch, i, wetBuffer.getSample (ch, i) * static_cast<SampleType> (duckingGain));
     }
 }
 
-void TapMatrixAudioProcessor::applyDryWetMix (juce::AudioBuffer<float>& outputBuffer,
-                                              const juce::AudioBuffer<float>& dryBuffer,
-                                              const juce::AudioBuffer<float>& wetBuffer,
+template <typename SampleType>
+void TapMatrixAudioProcessor::applyDryWetMix (juce::AudioBuffer<SampleType>& outputBuffer,
+                                              const juce::AudioBuffer<SampleType>& dryBuffer,
+                                              const juce::AudioBuffer<SampleType>& wetBuffer,
                                               int numSamples)
 {
-    float mix = parameters.getRawParameterValue ("mix")->load();
+    const auto mix = static_cast<SampleType> (globalControls.mix.getCurrentValue());
+    const auto dryGain = static_cast<SampleType> (1) - mix;
     
     const int numChannels = outputBuffer.getNumChannels();
     const int numDryChannels = dryBuffer.getNumChannels();
@@ -1032,7 +1911,7 @@ void TapMatrixAudioProcessor::applyDryWetMix (juce::AudioBuffer<float>& outputBu
         auto* output = outputBuffer.getWritePointer (ch);
         
         // Get dry signal (handle channel count mismatch)
-        const float* dryPtr = nullptr;
+        const SampleType* dryPtr = nullptr;
         if (ch < numDryChannels)
         {
             dryPtr = dryBuffer.getReadPointer (ch);
@@ -1044,13 +1923,13 @@ void TapMatrixAudioProcessor::applyDryWetMix (juce::AudioBuffer<float>& outputBu
         }
         
         // Get wet signal
-        const float* wetPtr = wetBuffer.getReadPointer (ch);
+        const SampleType* wetPtr = wetBuffer.getReadPointer (ch);
         
         // Mix: output = (1-mix) * dry + mix * wet
         if (dryPtr != nullptr)
         {
             for (int i = 0; i < numSamples; ++i)
-                output[i] = (1.0f - mix) * dryPtr[i] + mix * wetPtr[i];
+                output[i] = dryGain * dryPtr[i] + mix * wetPtr[i];
         }
         else
         {
@@ -1065,14 +1944,16 @@ void TapMatrixAudioProcessor::applyDryWetMix (juce::AudioBuffer<float>& outputBu
 // Tape Mode - Cubic Interpolation
 //==============================================================================
 
-float TapMatrixAudioProcessor::cubicInterpolate (float y0, float y1, float y2, float y3, float frac)
+template <typename SampleType>
+SampleType TapMatrixAudioProcessor::cubicInterpolate (SampleType y0, SampleType y1, SampleType y2, SampleType y3, SampleType frac)
 {
     // 4-point, 3rd-order Hermite interpolation (x-form)
     // Provides smooth interpolation with minimal overshoot
-    float c0 = y1;
-    float c1 = 0.5f * (y2 - y0);
-    float c2 = y0 - 2.5f * y1 + 2.0f * y2 - 0.5f * y3;
-    float c3 = 0.5f * (y3 - y0) + 1.5f * (y1 - y2);
+    // (the constants are exact at either precision)
+    SampleType c0 = y1;
+    SampleType c1 = 0.5f * (y2 - y0);
+    SampleType c2 = y0 - 2.5f * y1 + 2.0f * y2 - 0.5f * y3;
+    SampleType c3 = 0.5f * (y3 - y0) + 1.5f * (y1 - y2);
     
     return ((c3 * frac + c2) * frac + c1) * frac + c0;
 }
@@ -1083,18 +1964,42 @@ float TapMatrixAudioProcessor::cubicInterpolate (float y0, float y1, float y2, f
 
 void TapMatrixAudioProcessor::loadFactoryPreset (int presetIndex)
 {
+    // Build the complete preset first (unspecified parameters keep their current values),
+    // then publish it in one step - see publishParameterSnapshot
+    std::vector<float> snapshot (static_cast<size_t> (stateParameters.size()));
+    for (int i = 0; i < stateParameters.size(); ++i)
+    {
+        auto* param = stateParameters.getUnchecked (i);
+        snapshot[static_cast<size_t> (i)] = param->convertFrom0to1 (param->getValue());
+    }
+    
+    buildFactoryPresetSnapshot (presetIndex, snapshot);
+    publishParameterSnapshot (snapshot);
+}
+
+void TapMatrixAudioProcessor::buildFactoryPresetSnapshot (int presetIndex, std::vector<float>& snapshot) const
+{
+    // Helper lambda to set a parameter in the snapshot (snapped to its range)
+    auto setSnapshotValue = [this, &snapshot](const juce::String& paramID, float value)
+    {
+        const int index = stateParameterIDs.indexOf (paramID);
+        if (index >= 0)
+        {
+            auto* param = stateParameters.getUnchecked (index);
+            snapshot[static_cast<size_t> (index)] = param->convertFrom0to1 (param->convertTo0to1 (value));
+        }
+    };
+    
     // Helper lambda to set a tap parameter
-    auto setTapParam = [this](int tapIndex, const char* paramName, float value)
+    auto setTapParam = [&setSnapshotValue](int tapIndex, const char* paramName, float value)
     {
-        if (auto* param = parameters.getParameter (getTapParamID (paramName, tapIndex)))
-            param->setValueNotifyingHost (param->convertTo0to1 (value));
+        setSnapshotValue (getTapParamID (paramName, tapIndex), value);
     };
     
     // Helper lambda to set a global parameter
-    auto setGlobalParam = [this](const char* paramName, float value)
+    auto setGlobalParam = [&setSnapshotValue](const char* paramName, float value)
     {
-        if (auto* param = parameters.getParameter (paramName))
-            param->setValueNotifyingHost (param->convertTo0to1 (value));
+        setSnapshotValue (paramName, value);
     };
     
     switch (presetIndex)
@@ -1115,6 +2020,9 @@ void TapMatrixAudioProcessor::loadFactoryPreset (int presetIndex)
                 setTapParam (i, "panZ", 0.0f);
                 setTapParam (i, "syncMode", 0.0f);
                 setTapParam (i, "syncDelay", 0.25f * (i + 1));
+                
+                for (auto* depth : { "lfoDelayDepth", "lfoPanXDepth", "lfoPanYDepth", "lfoGainDepth", "lfoReverbDepth" })
+                    setTapParam (i, depth, 0.0f);
             }
             setGlobalParam ("mix", 1.0f);
             setGlobalParam ("outputGain", 0.0f);
@@ -1123,6 +2031,9 @@ void TapMatrixAudioProcessor::loadFactoryPreset (int presetIndex)
             setGlobalParam ("lpfFreq", 20000.0f);
             setGlobalParam ("ducking", 0.0f);
             setGlobalParam ("tapeMode", 1.0f);
+            setGlobalParam ("tapeWow", 0.0f);
+            setGlobalParam ("tapeFlutter", 0.0f);
+            setGlobalParam ("tapeSaturation", 0.0f);
             break;
         }
         
@@ -1284,6 +2195,152 @@ void TapMatrixAudioProcessor::loadFactoryPreset (int presetIndex)
     }
 }
 
+//==============================================================================
+// Preset Interrogation
+//==============================================================================
+
+void TapMatrixAudioProcessor::initialisePresetLibrary()
+{
+    using namespace BinaryStateFormat;
+    
+    // Every parameter counts equally, except the cosmetic accent hue
+    std::vector<float> weights (static_cast<size_t> (stateParameters.size()), 1.0f);
+    weights[static_cast<size_t> (getGlobalIndex (NUM_TAPS, globalHue))] = 0.0f;
+    presetLibrary.setWeights (weights);
+    
+    // Factory presets are applied on top of the default state
+    std::vector<float> snapshot (static_cast<size_t> (stateParameters.size()));
+    std::vector<float> normalised (snapshot.size());
+    
+    for (int preset = 0; preset < NUM_FACTORY_PRESETS; ++preset)
+    {
+        for (int i = 0; i < stateParameters.size(); ++i)
+        {
+            auto* param = stateParameters.getUnchecked (i);
+            snapshot[static_cast<size_t> (i)] = param->convertFrom0to1 (param->getDefaultValue());
+        }
+        
+        buildFactoryPresetSnapshot (preset, snapshot);
+        
+        for (int i = 0; i < stateParameters.size(); ++i)
+            normalised[static_cast<size_t> (i)] = stateParameters.getUnchecked (i)->convertTo0to1 (snapshot[static_cast<size_t> (i)]);
+        
+        presetLibrary.addOrReplacePreset (getProgramName (preset), normalised.data());
+    }
+}
+
+std::vector<float> TapMatrixAudioProcessor::getNormalisedState() const
+{
+    std::vector<float> values (static_cast<size_t> (stateParameters.size()));
+    for (int i = 0; i < stateParameters.size(); ++i)
+        values[static_cast<size_t> (i)] = stateParameters.getUnchecked (i)->getValue();
+    
+    return values;
+}
+
+PresetLibrary::Match TapMatrixAudioProcessor::findClosestPreset()
+{
+    if (presetLibraryNeedsBankSync)
+        syncPresetLibraryWithBank();
+    
+    const auto values = getNormalisedState();
+    return presetLibrary.findNearest (values.data());
+}
+
+int TapMatrixAudioProcessor::addCurrentStateToPresetLibrary (const juce::String& name)
+{
+    const auto values = getNormalisedState();
+    return presetLibrary.addOrReplacePreset (name, values.data());
+}
+
+juce::String TapMatrixAudioProcessor::getUserPresetLibraryName (int bankIndex) const
+{
+    // Presets in sub-folders are named by their folder path, e.g. "Ambient/Wide Wash"
+    const auto tags = userPresetBank->getPresetTags (bankIndex);
+    const auto name = userPresetBank->getPresetName (bankIndex);
+    return tags.isEmpty() ? name : tags + "/" + name;
+}
+
+void TapMatrixAudioProcessor::syncPresetLibraryWithBank()
+{
+    // Records are decoded here rather than when the bank opens, and only once per bank change
+    std::vector<float> bankValues (static_cast<size_t> (stateParameters.size()));
+    std::vector<float> normalised (bankValues.size());
+    juce::StringArray names;
+    
+    for (int bankIndex = 0; bankIndex < userPresetBank->getNumPresets(); ++bankIndex)
+    {
+        const int numValues = userPresetBank->getPresetValues (bankIndex, bankValues.data(), stateParameters.size());
+        
+        for (int i = 0; i < stateParameters.size(); ++i)
+        {
+            auto* param = stateParameters.getUnchecked (i);
+            const float value = bankValues[static_cast<size_t> (i)];
+            normalised[static_cast<size_t> (i)] = (i < numValues && std::isfinite (value)) ? param->convertTo0to1 (value)
+                                                                                           : param->getDefaultValue();
+        }
+        
+        const auto name = getUserPresetLibraryName (bankIndex);
+        presetLibrary.addOrReplacePreset (name, normalised.data());
+        names.add (name);
+    }
+    
+    // Drop presets that were deleted from the folder
+    for (auto& name : userPresetsInLibrary)
+        if (! names.contains (name))
+            presetLibrary.removePreset (presetLibrary.indexOfPreset (name));
+    
+    userPresetsInLibrary = names;
+    presetLibraryNeedsBankSync = false;
+}
+
+//==============================================================================
+// User Presets
+//==============================================================================
+
+void TapMatrixAudioProcessor::loadUserPreset (int bankIndex)
+{
+    // Parameters missing from older preset files fall back to their defaults
+    std::vector<float> bankValues (static_cast<size_t> (stateParameters.size()));
+    const int numValues = userPresetBank->getPresetValues (bankIndex, bankValues.data(), stateParameters.size());
+    
+    std::vector<float> snapshot (bankValues.size());
+    for (int i = 0; i < stateParameters.size(); ++i)
+    {
+        auto* param = stateParameters.getUnchecked (i);
+        const float value = bankValues[static_cast<size_t> (i)];
+        snapshot[static_cast<size_t> (i)] = (i < numValues && std::isfinite (value))
+                                              ? param->convertFrom0to1 (param->convertTo0to1 (value))
+                                              : param->convertFrom0to1 (param->getDefaultValue());
+    }
+    
+    publishParameterSnapshot (snapshot);
+}
+
+bool TapMatrixAudioProcessor::saveUserPreset (const juce::String& name)
+{
+    juce::MemoryBlock state;
+    getStateInformation (state);
+    
+    if (! userPresetBank->savePreset (name, state))
+        return false;
+    
+    // Searchable straight away; the bank catches up on its next scan
+    addCurrentStateToPresetLibrary (name);
+    userPresetsInLibrary.addIfNotAlreadyThere (name);
+    return true;
+}
+
+void TapMatrixAudioProcessor::changeListenerCallback (juce::ChangeBroadcaster* source)
+{
+    juce::ignoreUnused (source);
+    
+    // A new bank was swapped in: refresh the host's program list
+    presetLibraryNeedsBankSync = true;
+    currentPresetIndex = juce::jmin (currentPresetIndex, getNumPrograms() - 1);
+    updateHostDisplay (ChangeDetails().withProgramChanged (true));
+}
+
 //==============================================================================
 // This creates new instances of the plugin
 juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
@@ -3,27 +3,42 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
 #include <array>
+#include "TapeEngine.h"
+#include "DampingFilterBank.h"
+#include "InputRouting.h"
+#include "LfoBank.h"
+#include "StageProfiler.h"
+#include "LoadGovernor.h"
+#include "BinaryStateFormat.h"
+#include "PresetLibrary.h"
+#include "UserPresetBank.h"
 
 //==============================================================================
 /**
  * Single delay tap with feedback, crosstalk, damping, and reverb
+ * 
+ * The delay line runs at the processing precision (float or double). The reverb
+ * is float-only, so its send and return convert at the reverb.
  */
+template <typename SampleType>
 struct DelayTap
 {
     // Per-tap circular buffer
-    juce::AudioBuffer<float> buffer;
+    juce::AudioBuffer<SampleType> buffer;
     int writePosition = 0;
     int bufferLength = 0;
     int bufferMask = 0;  // For fast power-of-2 wrapping
     
     // Per-tap state
-    float lastOutputSample = 0.0f;
-    float dampingCoeff = 1.0f;  // 1.0 = no damping, 0.0 = full damping
+    SampleType lastOutputSample = 0;
     
     // Tape mode - smooth delay time changes
     float currentDelaySamples = 0.0f;  // Current smoothed delay time
     float targetDelaySamples = 0.0f;   // Target delay time
     
+    // Tape mode - wow/flutter oscillators
+    TapeEngine::TapeTransport tape;
+    
     // Tempo sync state (stored separately from TIME mode)
     bool useSyncMode = false;           // true = SYNC (beats), false = TIME (ms)
     float syncDelayBeats = 0.0f;        // Delay in quarter notes (0-10)
@@ -33,6 +48,8 @@ struct DelayTap
     
     // Level metering (pre-pan)
     std::atomic<float> currentLevel { 0.0f };  // RMS level for UI display
+    float meterSumSquares = 0.0f;              // Accumulated over one host block
+    int meterSampleCount = 0;
     
     void prepareToPlay (double sampleRate, int maxDelayMs)
     {
@@ -43,18 +60,232 @@ struct DelayTap
         buffer.setSize (1, bufferLength);  // Mono buffer per tap
         buffer.clear();
         writePosition = 0;
-        lastOutputSample = 0.0f;
+        lastOutputSample = 0;
         currentDelaySamples = 0.0f;
         targetDelaySamples = 0.0f;
+        meterSumSquares = 0.0f;
+        meterSampleCount = 0;
+    }
+    
+    /** Free the delay line (taps at a precision the host is not using) */
+    void release()
+    {
+        buffer.setSize (1, 0);
+        bufferLength = 0;
+        bufferMask = 0;
+        reset();
     }
     
     void reset()
     {
         buffer.clear();
         writePosition = 0;
-        lastOutputSample = 0.0f;
+        lastOutputSample = 0;
         currentDelaySamples = 0.0f;
         targetDelaySamples = 0.0f;
+        meterSumSquares = 0.0f;
+        meterSampleCount = 0;
+    }
+};
+
+//==============================================================================
+/**
+ * Per-tap parameters sampled at control rate
+ * 
+ * Raw parameter pointers are resolved once (no string lookups on the audio thread).
+ * Targets are read at every control boundary and ramped with SmoothedValue at
+ * control rate, so each value is constant for the duration of a sub-block.
+ */
+struct TapControls
+{
+    // Raw parameter pointers, indexed by BinaryStateFormat::TapParameter
+    std::array<std::atomic<float>*, BinaryStateFormat::numTapParameters> params {};
+    
+    // Smoothed values (advanced once per control block)
+    juce::SmoothedValue<float> gain;       // Linear gain
+    juce::SmoothedValue<float> feedback;
+    juce::SmoothedValue<float> crosstalk;
+    juce::SmoothedValue<float> damping;
+    juce::SmoothedValue<float> reverb;
+    juce::SmoothedValue<float> panX;
+    juce::SmoothedValue<float> panY;
+    juce::SmoothedValue<float> panZ;
+    
+    // Stepped values (delay time glides in the tape engine instead)
+    float delayTimeMs = 0.0f;
+    bool syncMode = false;
+    float syncDelayBeats = 0.0f;
+    
+    // Input routing (version 2 parameter, stored outside the version 1 block)
+    std::atomic<float>* inputSourceParam = nullptr;
+    int inputSource = InputRouter::monoSum;
+    
+    // Modulation settings (version 3 parameters, indexed by BinaryStateFormat::TapParameterV3)
+    std::array<std::atomic<float>*, BinaryStateFormat::numTapParametersV3> modulationParams {};
+    int lfoShape = 0;
+    float lfoRateHz = 1.0f;
+    bool lfoSync = false;
+    float lfoSyncBeats = 4.0f;          // Quarter notes per cycle
+    float lfoDelayDepthMs = 0.0f;       // +/- around the delay time
+    float lfoPanXDepth = 0.0f;          // +/- around the pan position
+    float lfoPanYDepth = 0.0f;
+    float lfoGainDepthDb = 0.0f;        // Dips by up to this much at the LFO minimum
+    float lfoReverbDepth = 0.0f;        // +/- around the reverb amount
+    
+    // Modulated values for the current control interval (computed at control rate). Gain and
+    // pan are ramped across the interval from the previous update's values.
+    float modulatedGain = 1.0f;
+    float modulatedPanX = 0.0f;
+    float modulatedPanY = 0.0f;
+    float modulatedReverb = 0.0f;
+    float previousModulatedGain = 1.0f;
+    float previousModulatedPanX = 0.0f;
+    float previousModulatedPanY = 0.0f;
+    bool hasModulatedValues = false;  // Cleared on reset so the first sub-block doesn't ramp from defaults
+    
+    /** Set targets from plain values indexed by BinaryStateFormat::TapParameter */
+    void setTargets (const float* values)
+    {
+        using namespace BinaryStateFormat;
+        
+        gain.setTargetValue (juce::Decibels::decibelsToGain (values[tapGain]));
+        feedback.setTargetValue (juce::jlimit (0.0f, 0.995f, values[tapFeedback]));  // Hard limit to prevent runaway
+        crosstalk.setTargetValue (values[tapCrosstalk]);
+        damping.setTargetValue (values[tapDamping]);
+        reverb.setTargetValue (values[tapReverb]);
+        panX.setTargetValue (values[tapPanX]);
+        panY.setTargetValue (values[tapPanY]);
+        panZ.setTargetValue (values[tapPanZ]);
+        
+        delayTimeMs = values[tapDelayTime];
+        syncMode = values[tapSyncMode] > 0.5f;
+        syncDelayBeats = values[tapSyncDelay];
+    }
+    
+    /** Set modulation settings from plain values indexed by BinaryStateFormat::TapParameterV3 */
+    void setModulationTargets (const float* values)
+    {
+        using namespace BinaryStateFormat;
+        
+        lfoShape = static_cast<int> (values[tapLfoShape] + 0.5f);  // Clamped by LfoBank::setShape
+        lfoRateHz = values[tapLfoRate];
+        lfoSync = values[tapLfoSync] > 0.5f;
+        lfoSyncBeats = juce::jmax (0.01f, values[tapLfoSyncBeats]);
+        lfoDelayDepthMs = values[tapLfoDelayDepth];
+        lfoPanXDepth = values[tapLfoPanXDepth];
+        lfoPanYDepth = values[tapLfoPanYDepth];
+        lfoGainDepthDb = values[tapLfoGainDepth];
+        lfoReverbDepth = values[tapLfoReverbDepth];
+    }
+    
+    /** Set targets from the live parameter values */
+    void readTargets()
+    {
+        std::array<float, BinaryStateFormat::numTapParameters> values;
+        for (size_t i = 0; i < values.size(); ++i)
+            values[i] = params[i]->load();
+        
+        setTargets (values.data());
+        inputSource = InputRouter::toSource (inputSourceParam->load());
+        
+        std::array<float, BinaryStateFormat::numTapParametersV3> modulationValues;
+        for (size_t i = 0; i < modulationValues.size(); ++i)
+            modulationValues[i] = modulationParams[i]->load();
+        
+        setModulationTargets (modulationValues.data());
+    }
+    
+    /** Apply one LFO output (-1 to +1) to this sub-block's gain, pan and reverb */
+    void applyModulation (float lfo)
+    {
+        previousModulatedGain = modulatedGain;
+        previousModulatedPanX = modulatedPanX;
+        previousModulatedPanY = modulatedPanY;
+        
+        modulatedGain = gain.getCurrentValue();
+        if (lfoGainDepthDb > 0.0f)
+            modulatedGain *= juce::Decibels::decibelsToGain (-0.5f * lfoGainDepthDb * (1.0f - lfo));
+        
+        modulatedPanX = juce::jlimit (-1.0f, 1.0f, panX.getCurrentValue() + lfo * lfoPanXDepth);
+        modulatedPanY = juce::jlimit (-1.0f, 1.0f, panY.getCurrentValue() + lfo * lfoPanYDepth);
+        modulatedReverb = juce::jlimit (0.0f, 1.0f, reverb.getCurrentValue() + lfo * lfoReverbDepth);
+        
+        if (! hasModulatedValues)
+        {
+            previousModulatedGain = modulatedGain;
+            previousModulatedPanX = modulatedPanX;
+            previousModulatedPanY = modulatedPanY;
+            hasModulatedValues = true;
+        }
+    }
+    
+    template <typename Function>
+    void forEachSmoothed (Function&& fn)
+    {
+        for (auto* value : { &gain, &feedback, &crosstalk, &damping, &reverb, &panX, &panY, &panZ })
+            fn (*value);
+    }
+};
+
+//==============================================================================
+/**
+ * Global parameters sampled at control rate (see TapControls)
+ */
+struct GlobalControls
+{
+    // Raw parameter pointers, indexed by BinaryStateFormat::GlobalParameter
+    std::array<std::atomic<float>*, BinaryStateFormat::numGlobalParameters> params {};
+    
+    // Smoothed values (advanced once per control block)
+    juce::SmoothedValue<float> mix;
+    juce::SmoothedValue<float> outputGain;  // Linear gain
+    juce::SmoothedValue<float> ducking;     // dB
+    juce::SmoothedValue<float> tapeWow;
+    juce::SmoothedValue<float> tapeFlutter;
+    juce::SmoothedValue<float> tapeSaturation;
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Multiplicative> hpfFreq;
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Multiplicative> lpfFreq;
+    
+    // Stepped values
+    int reverbType = 2;
+    bool tapeMode = true;
+    
+    /** Set targets from plain values indexed by BinaryStateFormat::GlobalParameter */
+    void setTargets (const float* values)
+    {
+        using namespace BinaryStateFormat;
+        
+        mix.setTargetValue (values[globalMix]);
+        outputGain.setTargetValue (juce::Decibels::decibelsToGain (values[globalOutputGain]));
+        ducking.setTargetValue (values[globalDucking]);
+        tapeWow.setTargetValue (values[globalTapeWow]);
+        tapeFlutter.setTargetValue (values[globalTapeFlutter]);
+        tapeSaturation.setTargetValue (values[globalTapeSaturation]);
+        hpfFreq.setTargetValue (values[globalHpfFreq]);
+        lpfFreq.setTargetValue (values[globalLpfFreq]);
+        
+        reverbType = static_cast<int> (values[globalReverbType]);
+        tapeMode = values[globalTapeMode] > 0.5f;
+    }
+    
+    /** Set targets from the live parameter values */
+    void readTargets()
+    {
+        std::array<float, BinaryStateFormat::numGlobalParameters> values;
+        for (size_t i = 0; i < values.size(); ++i)
+            values[i] = params[i]->load();
+        
+        setTargets (values.data());
+    }
+    
+    template <typename Function>
+    void forEachSmoothed (Function&& fn)
+    {
+        for (auto* value : { &mix, &outputGain, &ducking, &tapeWow, &tapeFlutter, &tapeSaturation })
+            fn (*value);
+        
+        fn (hpfFreq);
+        fn (lpfFreq);
     }
 };
 
@@ -80,9 +311,10 @@ enum class ReverbType
  * - Per-tap 3D panning (XYZ)
  * - Per-tap reverb
  * - Global filtering and ducking
- * - Tape mode for smooth delay modulation
+ * - Tape mode (delay glide, wow/flutter, feedback saturation)
  */
-class TapMatrixAudioProcessor : public juce::AudioProcessor
+class TapMatrixAudioProcessor : public juce::AudioProcessor,
+                                private juce::ChangeListener
 {
 public:
     //==============================================================================
@@ -96,6 +328,13 @@ public:
     bool isBusesLayoutSupported (const BusesLayout& layouts) const override;
 
     void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    void processBlockBypassed (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlockBypassed (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    
+    // The whole engine runs at the host's precision; only the reverbs and the SIMD
+    // feedback damping are float-only and convert at their boundaries
+    bool supportsDoublePrecisionProcessing() const override { return true; }
     
     // Helper: Convert quarter notes to milliseconds at given BPM
     static float beatsToMs (float quarterNotes, double bpm)
@@ -146,7 +385,8 @@ public:
     float getTapLevel (int tapIndex) const
     {
         if (tapIndex >= 0 && tapIndex < NUM_TAPS)
-            return taps[tapIndex].currentLevel.load();
+            return isUsingDoublePrecision() ? doubleEngine.taps[tapIndex].currentLevel.load()
+                                            : floatEngine.taps[tapIndex].currentLevel.load();
         return 0.0f;
     }
     
@@ -154,6 +394,35 @@ public:
     // Factory presets
     void loadFactoryPreset (int presetIndex);
     static constexpr int NUM_FACTORY_PRESETS = 8;
+    
+    //==============================================================================
+    // User presets (host programs after the factory presets) - message thread only
+    void loadUserPreset (int bankIndex);
+    
+    /** Save the current state as a user preset file (picked up by the bank scanner) */
+    bool saveUserPreset (const juce::String& name);
+    
+    UserPresetBank& getUserPresetBank() { return *userPresetBank; }
+    
+    //==============================================================================
+    // Preset interrogation (spec §5.3) - message thread only
+    /** Closest library preset to the current state, with modification percentage */
+    PresetLibrary::Match findClosestPreset();
+    
+    /** Add (or replace, by name) the current state in the preset library */
+    int addCurrentStateToPresetLibrary (const juce::String& name);
+    
+    PresetLibrary& getPresetLibrary() { return presetLibrary; }
+    
+    //==============================================================================
+    // CPU load governor - current quality level and smoothed load (any thread)
+    const LoadGovernor& getLoadGovernor() const { return loadGovernor; }
+    
+   #if TAPMATRIX_PROFILING
+    //==============================================================================
+    // Per-stage DSP timings (diagnostics builds only)
+    const StageProfiling::Profiler& getStageProfiler() const { return stageProfiler; }
+   #endif
 
 private:
     //==============================================================================
@@ -163,59 +432,237 @@ private:
     // Parameter tree state for automation and preset management
     juce::AudioProcessorValueTreeState parameters;
     
-    // 8 independent delay taps
-    std::array<DelayTap, NUM_TAPS> taps;
+    // Parameters in stable binary-state order (see BinaryStateFormat)
+    juce::StringArray stateParameterIDs;
+    juce::Array<juce::RangedAudioParameter*> stateParameters;
     
-    // Mono sum buffer (input is always summed to mono)
-    juce::AudioBuffer<float> monoInputBuffer;
+    static constexpr int MAX_CHANNELS = 8;  // Support up to 7.1
     
-    // Temporary buffer for tap outputs before panning
-    juce::AudioBuffer<float> tapOutputBuffer;
+    /**
+     * Everything that carries audio, at one processing precision
+     * 
+     * One instance per precision; prepareToPlay allocates only the one the host
+     * processes in, and processBlock<SampleType> runs on it.
+     */
+    template <typename SampleType>
+    struct EngineState
+    {
+        // 8 independent delay taps
+        std::array<DelayTap<SampleType>, NUM_TAPS> taps;
+        
+        // Temporary buffer for tap outputs before panning
+        juce::AudioBuffer<SampleType> tapOutputBuffer;
+        
+        // Pre-allocated crosstalk buffer (avoid real-time allocation)
+        juce::AudioBuffer<SampleType> crosstalkBuffer;
+        
+        // Dry signal buffer for mixing
+        juce::AudioBuffer<SampleType> dryBuffer;
+        
+        // Global processing chain
+        // HPF/LPF filters (12dB/oct = 2-pole = StateVariableFilter)
+        std::array<juce::dsp::StateVariableTPTFilter<SampleType>, MAX_CHANNELS> hpFilters;
+        std::array<juce::dsp::StateVariableTPTFilter<SampleType>, MAX_CHANNELS> lpFilters;
+    };
+    
+    EngineState<float> floatEngine;
+    EngineState<double> doubleEngine;
+    
+    template <typename SampleType>
+    EngineState<SampleType>& getEngine() noexcept
+    {
+        if constexpr (std::is_same_v<SampleType, double>)
+            return doubleEngine;
+        else
+            return floatEngine;
+    }
+    
+    template <typename Function>
+    void forEachEngine (Function&& fn)
+    {
+        fn (floatEngine);
+        fn (doubleEngine);
+    }
+    
+    // Per-tap input sources (mono sum, single channels, pairs), shared between taps
+    InputRouter inputRouter;
     
-    // Pre-allocated crosstalk buffer (avoid real-time allocation)
-    juce::AudioBuffer<float> crosstalkBuffer;
+    // Per-tap modulation LFOs (one SIMD pass per control block)
+    LfoBank<NUM_TAPS> lfoBank;
+    
+    // Feedback damping filters (one per tap, SIMD across taps, float at either precision)
+    DampingFilterBank<NUM_TAPS> dampingFilters;
     
     // Crosstalk matrix (8x8, diagonal is zero)
     std::array<std::array<float, NUM_TAPS>, NUM_TAPS> crosstalkMatrix;
     
-    // Global processing chain
-    // HPF/LPF filters (12dB/oct = 2-pole = StateVariableFilter)
-    static constexpr int MAX_CHANNELS = 8;  // Support up to 7.1
-    std::array<juce::dsp::StateVariableTPTFilter<float>, MAX_CHANNELS> hpFilters;
-    std::array<juce::dsp::StateVariableTPTFilter<float>, MAX_CHANNELS> lpFilters;
-    
-    // Dry signal buffer for mixing
-    juce::AudioBuffer<float> dryBuffer;
+    // Scratch buffer for per-tap reverb processing (juce::dsp::Reverb is float-only)
+    juce::AudioBuffer<float> reverbBuffer;
     
     // Ducking envelope follower state (squared domain for performance)
     float duckingEnvelopeSq = 0.0f;
+    float duckingAttackCoeff = 1.0f;
+    float duckingReleaseCoeff = 1.0f;
+    
+    // Control-rate scheduler
+    // processBlock runs in sub-blocks of at most CONTROL_BLOCK_SIZE samples; parameter
+    // targets are read at control boundaries, which carry across host blocks
+    static constexpr int CONTROL_BLOCK_SIZE = 32;
+    
+    static constexpr double CONTROL_RAMP_SECONDS = 0.02;
+    
+    // Scratch buffers are sized to one sub-block, independent of the host block size,
+    // so oversized or variable host blocks cannot overrun them and the per-chunk
+    // working set (input sources, tap outputs, crosstalk, dry) stays a few KB
+    static constexpr int MAX_SUB_BLOCK_SIZE = CONTROL_BLOCK_SIZE;
+    int samplesUntilControlUpdate = 0;
+    int controlInterval = CONTROL_BLOCK_SIZE;  // Samples between control updates (doubled under load)
+    
+    /** How far through the current control interval (0 to 1) the sub-block being processed is, offsetSamples in */
+    float getControlRampPosition (int offsetSamples) const
+    {
+        return static_cast<float> (controlInterval - samplesUntilControlUpdate + offsetSamples) / static_cast<float> (controlInterval);
+    }
+    double currentBPM = 120.0;
+    double hostPpqPosition = -1.0;     // Host block start, negative while the transport is stopped
+    double controlPpqPosition = -1.0;  // Current control boundary (tempo-synced LFOs)
+    
+    std::array<TapControls, NUM_TAPS> tapControls;
+    GlobalControls globalControls;
+    
+    // Tape coefficients (updated at control rate)
+    TapeEngine::BlockCoefficients tapeCoeffs;
+    
+    // Preset switching
+    // The message thread publishes a complete parameter snapshot; the audio thread fades
+    // the wet signal out, swaps to the snapshot in one step, and fades back in.
+    // Targets are frozen from the moment a snapshot is pending until the parameter tree
+    // has caught up with the snapshot that was swapped in (matched by generation).
+    enum class PresetFadeStage { idle, fadingOut, fadingIn };
+    static constexpr double PRESET_FADE_SECONDS = 0.010;  // Per fade stage
+    PresetFadeStage presetFadeStage = PresetFadeStage::idle;
+    int presetFadeLength = CONTROL_BLOCK_SIZE;  // Samples per stage (multiple of CONTROL_BLOCK_SIZE)
+    int presetFadePosition = 0;
+    bool presetSnapshotActive = false;          // Targets hold the swapped-in snapshot, live parameters ignored
+    juce::uint32 activeSnapshotGeneration = 0;  // Generation of the snapshot last swapped in
+    std::vector<float> presetSnapshot;          // Plain values in stable parameter order
+    juce::SpinLock presetSnapshotLock;
+    std::atomic<juce::uint32> presetSnapshotGeneration { 0 };  // Bumped with each published snapshot
+    std::atomic<juce::uint32> presetAppliedGeneration { 0 };   // Last snapshot fully written to the parameters
+    std::atomic<bool> presetSnapshotPending { false };
+    
+    // Bypass with trails
+    // While bypassed, input to the taps is muted and the dry signal passes at unity while
+    // echoes and reverb tails decay. Once the delay-line reads and reverb returns have stayed
+    // silent for longer than the longest delay, the engine is cleared and bypass becomes a
+    // plain passthrough. They are measured before tap gain, ducking and the preset fade, which
+    // can silence the output while the delay lines still recirculate audible energy.
+    static constexpr float BYPASS_SILENCE_THRESHOLD = 1.0e-5f;  // -100 dB
+    static constexpr int BYPASS_SILENCE_MARGIN_MS = 100;
+    bool bypassed = false;
+    juce::SmoothedValue<float> bypassBlend;     // 0 = processing, 1 = bypassed (control rate)
+    int bypassSilentSamples = 0;
+    float bypassTailPeak = 0.0f;                // Peak delay-line read / reverb return this sub-block
+    bool bypassTailsFinished = false;
     
     // Thread-safe reverb parameter updates
     std::atomic<bool> reverbParamsNeedUpdate { false };
     
+    // CPU load governor
+    // Measures each processBlock against the block duration and steps quality down
+    // (and back up, with hysteresis) when an overloaded session risks dropouts
+    static constexpr float INACTIVE_TAP_GAIN = 0.001f;  // -60 dB
+    LoadGovernor loadGovernor;
+    std::array<bool, NUM_TAPS> tapReverbsRunning {};  // Reverbs that processed the last sub-block
+    
+   #if TAPMATRIX_PROFILING
+    StageProfiling::Profiler stageProfiler;
+    std::unique_ptr<StageProfiling::ConsoleReporter> profilingConsoleReporter;  // Standalone only
+   #endif
+    
     // Helper functions
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
-    void processTaps (const float* monoInput, int numSamples, double bpm);
-    void applyCrosstalk (int numSamples);
-    void applyPanning (juce::AudioBuffer<float>& outputBuffer, int numSamples);
+    template <typename SampleType, typename UnusedSampleType>
+    void prepareEngine (EngineState<SampleType>& engine, EngineState<UnusedSampleType>& unusedEngine, double sampleRate);
+    template <typename SampleType>
+    void processBlockInternal (juce::AudioBuffer<SampleType>& buffer);
+    template <typename SampleType>
+    void processBlockBypassedInternal (juce::AudioBuffer<SampleType>& buffer);
+    template <typename SampleType>
+    void processEngine (juce::AudioBuffer<SampleType>& buffer);
+    template <typename SampleType>
+    void processSubBlock (juce::AudioBuffer<SampleType>& buffer, int numInputChannels);
+    template <typename SampleType>
+    void applyBypassDryGain (juce::AudioBuffer<SampleType>& outputBuffer, const juce::AudioBuffer<SampleType>& dryBuffer,
+                             int numInputChannels, int numSamples);
+    void resetEngineState();
+    template <typename SampleType>
+    void processTaps (EngineState<SampleType>& engine, int numSamples);
+    template <typename SampleType>
+    void applyCrosstalk (EngineState<SampleType>& engine, int numSamples);
+    template <typename SampleType>
+    void applyPanning (const EngineState<SampleType>& engine, juce::AudioBuffer<SampleType>& outputBuffer, int numSamples);
     
     // 3D Panning helpers
-    void panTapToStereo (int tapIndex, float* leftOut, float* rightOut, int numSamples);
-    void panTapTo51 (int tapIndex, juce::AudioBuffer<float>& outputBuffer, int numSamples);
-    void panTapTo71 (int tapIndex, juce::AudioBuffer<float>& outputBuffer, int numSamples);
+    template <typename SampleType>
+    void panTapToStereo (int tapIndex, const SampleType* tapInput, SampleType* leftOut, SampleType* rightOut, int numSamples);
+    template <typename SampleType>
+    void panTapTo51 (int tapIndex, const SampleType* tapInput, juce::AudioBuffer<SampleType>& outputBuffer, int numSamples);
+    template <typename SampleType>
+    void panTapTo71 (int tapIndex, const SampleType* tapInput, juce::AudioBuffer<SampleType>& outputBuffer, int numSamples);
+    
+    // Speaker gains for a pan position, indexed by output channel (LFE stays silent)
+    template <typename SampleType>
+    static std::array<SampleType, 2> getStereoPanGains (SampleType panX);
+    template <typename SampleType>
+    static std::array<SampleType, 6> get51PanGains (SampleType panX, SampleType panY);
+    template <typename SampleType>
+    static std::array<SampleType, 8> get71PanGains (SampleType panX, SampleType panY);
+    
+    /** dest += source * gain, with the gain moving linearly from startGain to endGain over the block */
+    template <typename SampleType>
+    static void addWithGainRamp (SampleType* dest, const SampleType* source, SampleType startGain, SampleType endGain, int numSamples);
+    
+    /** dest += source * gain across sample types (the boundary of the float-only reverbs) */
+    template <typename DestType, typename SourceType>
+    static void addConverted (DestType* dest, const SourceType* source, float gain, int numSamples);
+    
+    // Control-rate parameter handling
+    void resolveParameterPointers();
+    void resetControlState (double sampleRate);
+    template <typename SampleType>
+    void updateControlState (EngineState<SampleType>& engine);
+    void updateModulation (double sampleRate);
+    void updateTapMeters();
+    
+    // Preset switching helpers
+    void publishParameterSnapshot (const std::vector<float>& snapshot);
+    bool updatePresetFade();
+    bool applyPresetSnapshotTargets();
+    template <typename SampleType>
+    void applyPresetFadeGain (juce::AudioBuffer<SampleType>& wetBuffer, int numSamples);
     
     // Reverb configuration
     void updateReverbParameters();
     juce::dsp::Reverb::Parameters getReverbPreset (ReverbType type) const;
     
     // Global processing
-    void applyGlobalFilters (juce::AudioBuffer<float>& buffer, int numSamples);
-    void applyDucking (juce::AudioBuffer<float>& wetBuffer, const juce::AudioBuffer<float>& dryBuffer, int numSamples);
-    void applyDryWetMix (juce::AudioBuffer<float>& outputBuffer, const juce::AudioBuffer<float>& dryBuffer, 
-                         const juce::AudioBuffer<float>& wetBuffer, int numSamples);
+    template <typename SampleType>
+    void applyGlobalFilters (EngineState<SampleType>& engine, juce::AudioBuffer<SampleType>& buffer, int numSamples);
+    template <typename SampleType>
+    void applyDucking (juce::AudioBuffer<SampleType>& wetBuffer, const juce::AudioBuffer<SampleType>& dryBuffer, int numSamples);
+    template <typename SampleType>
+    void applyDryWetMix (juce::AudioBuffer<SampleType>& outputBuffer, const juce::AudioBuffer<SampleType>& dryBuffer, 
+                         const juce::AudioBuffer<SampleType>& wetBuffer, int numSamples);
     
     // Tape mode - cubic interpolation helper
-    static float cubicInterpolate (float y0, float y1, float y2, float y3, float frac);
+    template <typename SampleType>
+    static SampleType cubicInterpolate (SampleType y0, SampleType y1, SampleType y2, SampleType y3, SampleType frac);
+    
+    // Per-tap reverbs (shared between tap pairs and skipped on inactive taps under load)
+    template <typename SampleType>
+    void processTapReverbs (EngineState<SampleType>& engine, int numSamples);
+    bool isTapInactive (int tapIndex) const;
     
     // Current reverb type
     ReverbType currentReverbType = ReverbType::Medium;
@@ -223,6 +670,20 @@ private:
     // Current preset index
     int currentPresetIndex = 0;
     
+    // Preset library for interrogation (factory presets plus saved states)
+    PresetLibrary presetLibrary { BinaryStateFormat::getNumParameters (NUM_TAPS) };
+    void initialisePresetLibrary();
+    void buildFactoryPresetSnapshot (int presetIndex, std::vector<float>& snapshot) const;
+    std::vector<float> getNormalisedState() const;
+    
+    // User preset bank (shared by all instances, scanned in the background)
+    juce::SharedResourcePointer<UserPresetBank> userPresetBank;
+    juce::StringArray userPresetsInLibrary;      // Library names of bank presets
+    bool presetLibraryNeedsBankSync = true;      // Bank changed since the library was updated
+    void syncPresetLibraryWithBank();
+    juce::String getUserPresetLibraryName (int bankIndex) const;
+    void changeListenerCallback (juce::ChangeBroadcaster* source) override;
+    
     // UI state (persisted with plugin state)
     float uiScaleFactor = 1.0f;  // Default to 1x scale
     
@@ -254,3 +254,20 @@ void PositionControlGroup::setSliderLookAndFeel (juce::LookAndFeel* lf)
     frontBackFader.setLookAndFeel (lf);
     heightFader.setLookAndFeel (lf);
 }
+
+//==============================================================================
+// PARAMETER ATTACHMENTS
+//==============================================================================
+void PositionControlGroup::setParameterAttachmentsSuspended (bool shouldBeSuspended)
+{
+    leftRightFader.setParameterAttachmentSuspended (shouldBeSuspended);
+    frontBackFader.setParameterAttachmentSuspended (shouldBeSuspended);
+    heightFader.setParameterAttachmentSuspended (shouldBeSuspended);
+}
+
+void PositionControlGroup::setResizePreview (bool shouldPreview)
+{
+    leftRightFader.setResizePreview (shouldPreview);
+    frontBackFader.setResizePreview (shouldPreview);
+    heightFader.setResizePreview (shouldPreview);
+}
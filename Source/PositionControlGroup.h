@@ -147,6 +147,16 @@ public:
     /** Set the custom LookAndFeel for the slider modules */
     void setSliderLookAndFeel (juce::LookAndFeel* lf);
     
+    //==========================================================================
+    // PARAMETER ATTACHMENTS
+    //==========================================================================
+    
+    /** Suspend or resume all three faders' parameter attachments (see SliderModule) */
+    void setParameterAttachmentsSuspended (bool shouldBeSuspended);
+    
+    /** Start or end a window resize preview on all three faders (see SliderModule) */
+    void setResizePreview (bool shouldPreview);
+    
 private:
     //==========================================================================
     // MEMBER VARIABLES
@@ -0,0 +1,278 @@
+#include "PresetLibrary.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+//==============================================================================
+PresetLibrary::PresetLibrary (int dimensions)
+    : numDimensions (dimensions)
+{
+    setWeights (std::vector<float> (static_cast<size_t> (numDimensions), 1.0f));
+}
+
+//==============================================================================
+void PresetLibrary::setWeights (const std::vector<float>& newWeights)
+{
+    jassert (static_cast<int> (newWeights.size()) == numDimensions);
+
+    weights = newWeights;
+    totalWeight = 0.0f;
+
+    for (auto& weight : weights)
+    {
+        weight = juce::jmax (0.0f, weight);
+        totalWeight += weight;
+    }
+
+    // Split axes are chosen by weighted spread, so the tree depends on the weights
+    rebuildIndex();
+}
+
+int PresetLibrary::addOrReplacePreset (const juce::String& name, const float* normalisedValues)
+{
+    int presetIndex = names.indexOf (name);
+
+    if (presetIndex >= 0)
+    {
+        // Replacing moves the point: take it out of its old leaf first
+        if (! removed[static_cast<size_t> (presetIndex)])
+            removeFromIndex (presetIndex);
+
+        removed[static_cast<size_t> (presetIndex)] = false;
+    }
+    else
+    {
+        presetIndex = names.size();
+        names.add (name);
+        points.resize (points.size() + static_cast<size_t> (numDimensions));
+        removed.push_back (false);
+    }
+
+    storePoint (presetIndex, normalisedValues);
+    insertIntoIndex (presetIndex);
+    return presetIndex;
+}
+
+void PresetLibrary::removePreset (int presetIndex)
+{
+    if (! juce::isPositiveAndBelow (presetIndex, getNumPresets()) || removed[static_cast<size_t> (presetIndex)])
+        return;
+
+    removeFromIndex (presetIndex);
+    removed[static_cast<size_t> (presetIndex)] = true;
+}
+
+//==============================================================================
+PresetLibrary::Match PresetLibrary::findNearest (const float* normalisedValues) const
+{
+    Match match;
+
+    int bestIndex = -1;
+    float bestDistanceSq = std::numeric_limits<float>::max();
+    std::vector<float> offsets (static_cast<size_t> (numDimensions), 0.0f);
+    searchSubtree (0, normalisedValues, 0.0f, offsets, bestIndex, bestDistanceSq);
+
+    if (bestIndex < 0)
+        return match;
+
+    match.presetIndex = bestIndex;
+    match.name = names[bestIndex];
+
+    // Each normalised difference is at most 1, so the weighted RMS lies in 0-1
+    if (totalWeight > 0.0f)
+        match.modificationPercent = 100.0f * std::sqrt (bestDistanceSq / totalWeight);
+
+    return match;
+}
+
+//==============================================================================
+void PresetLibrary::storePoint (int presetIndex, const float* normalisedValues)
+{
+    float* point = points.data() + static_cast<size_t> (presetIndex) * static_cast<size_t> (numDimensions);
+
+    for (int d = 0; d < numDimensions; ++d)
+        point[d] = juce::jlimit (0.0f, 1.0f, normalisedValues[d]);
+}
+
+int PresetLibrary::findLeaf (const float* point) const
+{
+    int nodeIndex = 0;
+
+    while (! nodes[static_cast<size_t> (nodeIndex)].isLeaf())
+    {
+        const auto& node = nodes[static_cast<size_t> (nodeIndex)];
+        nodeIndex = point[node.splitDimension] < node.splitValue ? node.left : node.right;
+    }
+
+    return nodeIndex;
+}
+
+void PresetLibrary::insertIntoIndex (int presetIndex)
+{
+    const int leaf = findLeaf (getPoint (presetIndex));
+    nodes[static_cast<size_t> (leaf)].presets.push_back (presetIndex);
+
+    if (static_cast<int> (nodes[static_cast<size_t> (leaf)].presets.size()) > maxLeafSize)
+        splitLeaf (leaf);
+}
+
+void PresetLibrary::removeFromIndex (int presetIndex)
+{
+    // The stored point still leads to the leaf it was inserted into
+    auto& presets = nodes[static_cast<size_t> (findLeaf (getPoint (presetIndex)))].presets;
+    presets.erase (std::remove (presets.begin(), presets.end(), presetIndex), presets.end());
+}
+
+void PresetLibrary::splitLeaf (int nodeIndex)
+{
+    auto presets = std::move (nodes[static_cast<size_t> (nodeIndex)].presets);
+    nodes[static_cast<size_t> (nodeIndex)].presets.clear();
+
+    // Split on the axis with the widest (weighted) spread among this leaf's points
+    int splitDimension = -1;
+    float widestSpread = 0.0f;
+
+    for (int d = 0; d < numDimensions; ++d)
+    {
+        float lo = std::numeric_limits<float>::max();
+        float hi = std::numeric_limits<float>::lowest();
+
+        for (int presetIndex : presets)
+        {
+            const float value = getPoint (presetIndex)[d];
+            lo = juce::jmin (lo, value);
+            hi = juce::jmax (hi, value);
+        }
+
+        const float spread = weights[static_cast<size_t> (d)] * (hi - lo);
+        if (spread > widestSpread)
+        {
+            widestSpread = spread;
+            splitDimension = d;
+        }
+    }
+
+    // Identical points cannot be separated - leave the leaf oversized
+    if (splitDimension < 0)
+    {
+        nodes[static_cast<size_t> (nodeIndex)].presets = std::move (presets);
+        return;
+    }
+
+    // Median split
+    const auto mid = presets.begin() + static_cast<std::ptrdiff_t> (presets.size() / 2);
+    std::nth_element (presets.begin(), mid, presets.end(),
+                      [this, splitDimension] (int a, int b)
+                      {
+                          return getPoint (a)[splitDimension] < getPoint (b)[splitDimension];
+                      });
+
+    float splitValue = getPoint (*mid)[splitDimension];
+
+    const bool hasLower = std::any_of (presets.begin(), presets.end(), [&] (int presetIndex)
+                                       { return getPoint (presetIndex)[splitDimension] < splitValue; });
+
+    if (! hasLower)
+    {
+        // Median equals the minimum: split just above it instead (spread > 0, so a larger value exists)
+        float nextValue = std::numeric_limits<float>::max();
+        for (int presetIndex : presets)
+        {
+            const float value = getPoint (presetIndex)[splitDimension];
+            if (value > splitValue)
+                nextValue = juce::jmin (nextValue, value);
+        }
+        splitValue = nextValue;
+    }
+
+    Node left, right;
+    for (int presetIndex : presets)
+        (getPoint (presetIndex)[splitDimension] < splitValue ? left : right).presets.push_back (presetIndex);
+
+    const int leftIndex = static_cast<int> (nodes.size());
+    nodes.push_back (std::move (left));
+    nodes.push_back (std::move (right));
+
+    auto& node = nodes[static_cast<size_t> (nodeIndex)];
+    node.splitDimension = splitDimension;
+    node.splitValue = splitValue;
+    node.left = leftIndex;
+    node.right = leftIndex + 1;
+
+    // Very uneven splits can leave a child over capacity
+    for (int child : { leftIndex, leftIndex + 1 })
+        if (static_cast<int> (nodes[static_cast<size_t> (child)].presets.size()) > maxLeafSize)
+            splitLeaf (child);
+}
+
+void PresetLibrary::rebuildIndex()
+{
+    nodes.clear();
+    nodes.emplace_back();  // Root starts as an empty leaf
+
+    for (int i = 0; i < getNumPresets(); ++i)
+        if (! removed[static_cast<size_t> (i)])
+            nodes[0].presets.push_back (i);
+
+    if (static_cast<int> (nodes[0].presets.size()) > maxLeafSize)
+        splitLeaf (0);
+}
+
+//==============================================================================
+void PresetLibrary::searchSubtree (int nodeIndex, const float* query, float cellDistanceSq,
+                                   std::vector<float>& offsets, int& bestIndex, float& bestDistanceSq) const
+{
+    const auto& node = nodes[static_cast<size_t> (nodeIndex)];
+
+    if (node.isLeaf())
+    {
+        for (int presetIndex : node.presets)
+        {
+            const float d = distanceSq (query, getPoint (presetIndex), bestDistanceSq);
+            if (d < bestDistanceSq)
+            {
+                bestDistanceSq = d;
+                bestIndex = presetIndex;
+            }
+        }
+        return;
+    }
+
+    // Visit the query's side first, then the far side only if its cell could hold a closer point
+    const int dim = node.splitDimension;
+    const float axisDistance = query[dim] - node.splitValue;
+    const int nearChild = axisDistance < 0.0f ? node.left : node.right;
+    const int farChild = axisDistance < 0.0f ? node.right : node.left;
+
+    searchSubtree (nearChild, query, cellDistanceSq, offsets, bestIndex, bestDistanceSq);
+
+    // Incremental cell distance (Arya & Mount): replace this axis' contribution only
+    const float weight = weights[static_cast<size_t> (dim)];
+    const float oldOffset = offsets[static_cast<size_t> (dim)];
+    const float farCellDistanceSq = cellDistanceSq + weight * (axisDistance * axisDistance - oldOffset * oldOffset);
+
+    if (farCellDistanceSq < bestDistanceSq)
+    {
+        offsets[static_cast<size_t> (dim)] = axisDistance;
+        searchSubtree (farChild, query, farCellDistanceSq, offsets, bestIndex, bestDistanceSq);
+        offsets[static_cast<size_t> (dim)] = oldOffset;
+    }
+}
+
+float PresetLibrary::distanceSq (const float* a, const float* b, float limit) const
+{
+    // Partial distance: stop as soon as this point cannot beat the current best
+    float sum = 0.0f;
+    for (int d = 0; d < numDimensions; d += 8)
+    {
+        for (int k = d; k < juce::jmin (d + 8, numDimensions); ++k)
+        {
+            const float diff = a[k] - b[k];
+            sum += weights[static_cast<size_t> (k)] * diff * diff;
+        }
+
+        if (sum >= limit)
+            break;
+    }
+    return sum;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <vector>
+
+/**
+ * Preset library with nearest-match search (spec §5.3 "Preset Interrogation")
+ *
+ * Features:
+ * - Each preset is a normalised (0-1) parameter vector in stable state order
+ * - Per-parameter weights (a weight of 0 excludes a parameter, e.g. UI hue)
+ * - Bucketed k-d tree index under the weighted distance. Inserts, replacements
+ *   and removals update it incrementally (a full leaf splits in two).
+ *
+ * Not thread-safe: use from the message thread only.
+ */
+class PresetLibrary
+{
+public:
+    //==========================================================================
+    struct Match
+    {
+        int presetIndex = -1;             // -1 if the library is empty
+        juce::String name;
+        float modificationPercent = 0.0f; // Weighted RMS difference, 0-100%
+
+        bool isValid() const { return presetIndex >= 0; }
+    };
+
+    //==========================================================================
+    explicit PresetLibrary (int numDimensions);
+
+    int getNumDimensions() const { return numDimensions; }
+    int getNumPresets() const { return names.size(); }
+
+    // Set per-parameter weights (one per dimension, >= 0). Rebuilds the index.
+    void setWeights (const std::vector<float>& newWeights);
+
+    // Add a preset, or replace the one with the same name. Returns its index.
+    int addOrReplacePreset (const juce::String& name, const float* normalisedValues);
+
+    // Remove a preset from search results (its index stays reserved)
+    void removePreset (int presetIndex);
+
+    const juce::String& getPresetName (int presetIndex) const { return names.getReference (presetIndex); }
+    int indexOfPreset (const juce::String& name) const { return names.indexOf (name); }
+
+    // Closest preset to a normalised parameter vector
+    Match findNearest (const float* normalisedValues) const;
+
+private:
+    //==========================================================================
+    static constexpr int maxLeafSize = 16;
+
+    struct Node
+    {
+        // Internal node: splitDimension >= 0, points with value < splitValue go left
+        int splitDimension = -1;
+        float splitValue = 0.0f;
+        int left = -1;
+        int right = -1;
+
+        // Leaf node: preset indices (scanned linearly)
+        std::vector<int> presets;
+
+        bool isLeaf() const { return splitDimension < 0; }
+    };
+
+    //==========================================================================
+    const int numDimensions;
+    std::vector<float> weights;
+    float totalWeight = 0.0f;
+
+    juce::StringArray names;
+    std::vector<float> points;             // Normalised vectors, numDimensions per preset
+    std::vector<bool> removed;
+
+    std::vector<Node> nodes;               // nodes[0] is the root
+
+    //==========================================================================
+    const float* getPoint (int presetIndex) const { return points.data() + static_cast<size_t> (presetIndex) * static_cast<size_t> (numDimensions); }
+    void storePoint (int presetIndex, const float* normalisedValues);
+
+    int findLeaf (const float* point) const;
+    void insertIntoIndex (int presetIndex);
+    void removeFromIndex (int presetIndex);
+    void splitLeaf (int nodeIndex);
+    void rebuildIndex();
+
+    void searchSubtree (int node, const float* query, float cellDistanceSq,
+                        std::vector<float>& offsets, int& bestIndex, float& bestDistanceSq) const;
+    float distanceSq (const float* a, const float* b, float limit) const;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PresetLibrary)
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include "StageProfiler.h"
+
+#if TAPMATRIX_PROFILING
+
+//==============================================================================
+/**
+ * Diagnostics overlay (profiling builds only)
+ *
+ * Shows the latest per-stage DSP timings from the processor's stage profiler.
+ * Hidden by default; the editor toggles it with Alt+Shift+click on its background.
+ * Click-through, so it never gets in the way of the controls underneath.
+ */
+class ProfilerOverlay : public juce::Component
+{
+public:
+    explicit ProfilerOverlay (const StageProfiling::Profiler& p) : profiler (p)
+    {
+        setInterceptsMouseClicks (false, false);
+    }
+
+    /** Pull the latest published report (message thread, call from a timer) */
+    void refresh()
+    {
+        StageProfiling::Report report;
+        if (! profiler.getReport (report))
+            return;
+
+        lines = StageProfiling::formatReport (report);
+        repaint();
+    }
+
+    void paint (juce::Graphics& g) override
+    {
+        g.fillAll (juce::Colours::black.withAlpha (0.75f));
+        g.setColour (juce::Colours::white);
+        g.setFont (juce::FontOptions (juce::Font::getDefaultMonospacedFontName(), 12.0f, juce::Font::plain));
+
+        if (lines.isEmpty())
+        {
+            g.drawText ("Waiting for audio...", getLocalBounds().reduced (8), juce::Justification::topLeft);
+            return;
+        }
+
+        auto area = getLocalBounds().reduced (8);
+        for (auto& line : lines)
+            g.drawText (line, area.removeFromTop (16), juce::Justification::left, false);
+    }
+
+private:
+    const StageProfiling::Profiler& profiler;
+    juce::StringArray lines;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ProfilerOverlay)
+};
+
+#endif
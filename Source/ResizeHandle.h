@@ -21,6 +21,7 @@ namespace UIScaling
     static constexpr float minScale = 1.0f;
     static constexpr float maxScale = 3.0f;
     static constexpr float scaleStep = 0.1f;
+    static constexpr int numScaleSteps = 21;  // 1.0, 1.1, ... 3.0
     
     // Helper to snap scale to nearest 0.1 step
     inline float snapToStep (float scale)
@@ -29,6 +30,12 @@ namespace UIScaling
                             std::round (scale / scaleStep) * scaleStep);
     }
     
+    // Index of a scale factor's step (0 = 1.0x ... numScaleSteps - 1 = 3.0x)
+    inline int getStepIndex (float scale)
+    {
+        return juce::roundToInt ((snapToStep (scale) - minScale) / scaleStep);
+    }
+    
     // Get width for a given scale factor
     inline int getWidthForScale (float scale) { return static_cast<int> (baseWidth * scale); }
     
@@ -55,6 +62,7 @@ namespace UIScaling
  * A triangular drag handle for the bottom-right corner of the plugin window.
  * Allows resizing while maintaining the 55:41 aspect ratio.
  * Scale factor is stepped to 0.1 increments (1.0, 1.1, 1.2, ... 3.0).
+ * onResize is only called when the dragged size reaches a different step.
  */
 class ResizeHandle : public juce::Component
 {
@@ -70,6 +78,9 @@ public:
     /** Called when user drags to resize. Provides the new scale factor (1.0-3.0, stepped by 0.1) */
     std::function<void (float newScaleFactor)> onResize;
     
+    /** Called when the drag ends */
+    std::function<void()> onResizeEnd;
+    
     //==========================================================================
     // CONSTRUCTOR
     //==========================================================================
@@ -106,9 +117,16 @@ public:
         {
             dragStartSize = parent->getLocalBounds();
             dragStartPos = e.getScreenPosition();
+            lastReportedScale = UIScaling::getScaleFromWidth (dragStartSize.getWidth());
         }
     }
     
+    void mouseUp (const juce::MouseEvent&) override
+    {
+        if (onResizeEnd != nullptr)
+            onResizeEnd();
+    }
+    
     void mouseDrag (const juce::MouseEvent& e) override
     {
         if (onResize == nullptr)
@@ -135,13 +153,19 @@ public:
         // Clamp to valid range
         newScale = juce::jlimit (UIScaling::minScale, UIScaling::maxScale, newScale);
         
+        // Most mouse moves stay within the current step
+        if (juce::approximatelyEqual (newScale, lastReportedScale))
+            return;
+        
         // Notify parent of new scale
+        lastReportedScale = newScale;
         onResize (newScale);
     }
     
 private:
     juce::Rectangle<int> dragStartSize;
     juce::Point<int> dragStartPos;
+    float lastReportedScale = 0.0f;
     
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ResizeHandle)
 };
@@ -1,5 +1,7 @@
 #include "SliderModule.h"
 #include "ColorPalette.h"
+#include "EmbeddedAssets.h"
+#include "TextLayoutCache.h"
 
 //==============================================================================
 // CUSTOM SLIDER - Forwards double-clicks to parent SliderModule
@@ -34,15 +36,6 @@ void SliderModuleSlider::mouseDown (const juce::MouseEvent& event)
     juce::Slider::mouseDown (event);
 }
 
-//==============================================================================
-// STATIC MEMBER INITIALIZATION
-// Shared sprite caches - loaded once per style, shared across all instances
-//==============================================================================
-std::map<FaderStyle, juce::Image> SliderModule::fillBarImages;        // Base spritesheet per style
-std::map<FaderStyle, bool> SliderModule::fillBarImagesLoaded;         // Load status flags
-std::map<std::pair<FaderStyle, int>, juce::Image> SliderModule::colorVariants;  // Pre-tinted variants (style, colorIndex)
-std::map<FaderStyle, bool> SliderModule::colorVariantsLoaded;         // Color variant load status
-
 //==============================================================================
 // FADER STYLE INFO LOOKUP
 //
@@ -54,6 +47,8 @@ std::map<FaderStyle, bool> SliderModule::colorVariantsLoaded;         // Color v
 // - spritesheetFrameWidth/Height are the 4x values from the PNG
 // - Divide by 4 to get display size (which should match trackWidth/trackHeight)
 // - Total PNG height = spritesheetTotalFrames × spritesheetFrameHeight
+// - Sheets are kept in FaderSpriteStore as distinct pixel rows; frames are
+//   decoded on demand at the physical size they are drawn at
 //
 // Example for Fader_38x170:
 //   Track: 38×170 display pixels (at 1.0x scale)
@@ -321,6 +316,7 @@ SliderModule::SliderModule (const juce::String& labelText, FaderStyle style)
     
     // Load fill bar spritesheet for this style (shared by all instances of same style)
     loadFillBarForStyle();
+    fillBarTint = getVariantForColor (accentColour);
 }
 
 SliderModule::~SliderModule()
@@ -332,6 +328,7 @@ void SliderModule::attachToParameter (juce::AudioProcessorValueTreeState& apvts,
 {
     // Store the parameter ID for reference
     currentParameterID = parameterID;
+    attachedState = &apvts;
     
     // Create or recreate the attachment
     // This automatically detaches from any previous parameter
@@ -343,10 +340,40 @@ void SliderModule::detachFromParameter()
 {
     // Reset attachment to detach from parameter
     attachment.reset();
+    attachedState = nullptr;
     currentParameterID.clear();
     slider.setValue (0.5, juce::dontSendNotification);
 }
 
+void SliderModule::setParameterAttachmentSuspended (bool shouldBeSuspended)
+{
+    if (attachedState == nullptr)
+        return;  // Not attached to anything
+    
+    if (shouldBeSuspended)
+    {
+        // Slider keeps showing the last value; nothing listens to the parameter
+        attachment.reset();
+    }
+    else if (attachment == nullptr)
+    {
+        // New attachment syncs the slider to the parameter's current value
+        attachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment> (
+            *attachedState, currentParameterID, slider);
+    }
+}
+
+void SliderModule::setResizePreview (bool shouldPreview)
+{
+    if (resizePreview == shouldPreview)
+        return;
+    
+    resizePreview = shouldPreview;
+    
+    if (!resizePreview)
+        repaint();  // Prepare and draw frames at the settled size
+}
+
 void SliderModule::setLabelText (const juce::String& text)
 {
     parameterName = text;
@@ -364,6 +391,10 @@ void SliderModule::setLabelText (const juce::AttributedString& attributedText)
     attributedLabel.setWordWrap (juce::AttributedString::none);
     useAttributedLabel = true;
     
+    // The label's fonts are fixed, so lay it out now rather than on every paint
+    // Use a very large width to prevent any word wrapping - single line only
+    attributedLabelLayout.createLayout (attributedLabel, 10000.0f);
+    
     // Hide the standard label - we'll draw the AttributedString ourselves
     nameLabel.setVisible (false);
     
@@ -404,133 +435,30 @@ void SliderModule::setValueDisplayMode (ValueDisplayMode mode)
 void SliderModule::loadFillBarForStyle()
 {
     // Check if already loaded for this style
-    if (fillBarImagesLoaded[faderStyle])
+    auto& spriteStore = *FaderSpriteStore::getInstance();
+    if (spriteStore.hasSheet (static_cast<int> (faderStyle)))
         return;
     
-    auto assetsPath = juce::File (getAssetsBasePath());
-    auto stylePath = assetsPath.getChildFile (styleInfo.folderName);
-    auto fillBarFile = stylePath.getChildFile (styleInfo.folderName + "_sprite_sheet.png");
-    
-    if (fillBarFile.existsAsFile())
-    {
-        auto image = juce::ImageCache::getFromFile (fillBarFile);
-        if (!image.isNull())
-        {
-            fillBarImages[faderStyle] = image;
-            fillBarImagesLoaded[faderStyle] = true;
-            
-            // Load color variants for this style
-            loadColorVariantsForStyle();
-        }
-    }
-    else
+    // Decoded outside ImageCache so the full sheet is released once compacted
+    auto image = EmbeddedAssets::loadImage (styleInfo.folderName + "_sprite_sheet.png");
+    if (!image.isNull())
     {
-        DBG ("ERROR: Fill bar spritesheet not found: " + fillBarFile.getFullPathName());
+        // Color variants are tinted in memory when first drawn
+        spriteStore.addSheet (static_cast<int> (faderStyle), image,
+                              styleInfo.spritesheetFrameWidth, styleInfo.spritesheetFrameHeight);
     }
 }
 
-void SliderModule::loadColorVariantsForStyle()
+void SliderModule::setAccentColour (juce::Colour colour)
 {
-    // Check if already loaded for this style
-    if (colorVariantsLoaded[faderStyle])
-        return;
-    
-    auto assetsPath = juce::File (getAssetsBasePath());
-    auto stylePath = assetsPath.getChildFile (styleInfo.folderName);
-    
-    // Check if cache files exist - if not, generate them first
-    bool cacheExists = true;
-    for (int i = 0; i < 10; ++i)
-    {
-        auto variantFile = stylePath.getChildFile (styleInfo.folderName + "_color" + juce::String(i) + ".png");
-        if (!variantFile.existsAsFile())
-        {
-            cacheExists = false;
-            break;
-        }
-    }
-    
-    if (!cacheExists)
-        generateColorVariantCacheForStyle();
-    
-    // Load each pre-cached color variant PNG file
-    for (int i = 0; i < 10; ++i)
-    {
-        auto variantFile = stylePath.getChildFile (styleInfo.folderName + "_color" + juce::String(i) + ".png");
-        
-        if (variantFile.existsAsFile())
-        {
-            auto variantImage = juce::ImageCache::getFromFile (variantFile);
-            if (!variantImage.isNull())
-                colorVariants[{faderStyle, i}] = variantImage;
-        }
-    }
-    
-    colorVariantsLoaded[faderStyle] = true;
-}
+    accentColour = colour;
 
-void SliderModule::generateColorVariantCacheForStyle()
-{
-    // Get palette colors from central definition
-    auto paletteColors = ColorPalette::getBackgroundColors();
-    
-    // Ensure fill bar is loaded for this style
-    auto it = fillBarImages.find (faderStyle);
-    if (it == fillBarImages.end() || it->second.isNull())
-    {
-        DBG ("ERROR: Cannot generate color variants - source image not loaded for style: " + styleInfo.folderName);
-        return;
-    }
-    
-    const auto& sourceImage = it->second;
-    
-    auto assetsPath = juce::File (getAssetsBasePath());
-    auto stylePath = assetsPath.getChildFile (styleInfo.folderName);
-    
-    // Generate tinted variants for each palette color and save as PNG
-    for (size_t i = 0; i < paletteColors.size(); ++i)
-    {
-        auto colour = paletteColors[i];
-        
-        // Clone and tint the spritesheet
-        auto tintedImage = sourceImage.createCopy();
-        
-        // Fast color multiplication using BitmapData
-        juce::Image::BitmapData bitmapData (tintedImage, juce::Image::BitmapData::readWrite);
-        
-        float tintR = colour.getFloatRed();
-        float tintG = colour.getFloatGreen();
-        float tintB = colour.getFloatBlue();
-        
-        for (int y = 0; y < bitmapData.height; ++y)
-        {
-            for (int x = 0; x < bitmapData.width; ++x)
-            {
-                auto pixel = bitmapData.getPixelColour (x, y);
-                auto tinted = juce::Colour::fromFloatRGBA (
-                    pixel.getFloatRed() * tintR,
-                    pixel.getFloatGreen() * tintG,
-                    pixel.getFloatBlue() * tintB,
-                    pixel.getFloatAlpha()
-                );
-                bitmapData.setPixelColour (x, y, tinted);
-            }
-        }
-        
-        // Save as PNG file
-        auto outputFile = stylePath.getChildFile (styleInfo.folderName + "_color" + juce::String(i) + ".png");
-        juce::FileOutputStream outputStream (outputFile);
-        
-        if (outputStream.openedOk())
-        {
-            juce::PNGImageFormat pngFormat;
-            pngFormat.writeImageToStream (tintedImage, outputStream);
-            DBG ("Generated color variant: " + outputFile.getFullPathName());
-        }
-    }
+    // Palette lookup happens here rather than on every paint
+    fillBarTint = getVariantForColor (colour);
+    preparedFrameSize = {};
 }
 
-const juce::Image& SliderModule::getVariantForColor (const juce::Colour& colour) const
+juce::Colour SliderModule::getVariantForColor (const juce::Colour& colour) const
 {
     // Get palette colors from central definition
     auto paletteColors = ColorPalette::getBackgroundColors();
@@ -554,26 +482,18 @@ const juce::Image& SliderModule::getVariantForColor (const juce::Colour& colour)
         }
     }
     
-    // Look up the variant for this fader style
-    auto it = colorVariants.find ({faderStyle, closestIndex});
-    if (it != colorVariants.end())
-        return it->second;
-    
-    // Fallback to original grayscale if variant not found
-    auto fillIt = fillBarImages.find (faderStyle);
-    if (fillIt != fillBarImages.end())
-        return fillIt->second;
+    // Fallback to original grayscale if the palette is empty
+    if (paletteColors.isEmpty())
+        return juce::Colours::white;
     
-    // Ultimate fallback - return empty static image
-    static juce::Image emptyImage;
-    return emptyImage;
+    return paletteColors[closestIndex];
 }
 
 void SliderModule::paint (juce::Graphics& g)
 {
-    // Get the fill bar image for this style
-    auto fillIt = fillBarImages.find (faderStyle);
-    if (fillIt == fillBarImages.end() || fillIt->second.isNull())
+    // Check the fill bar is loaded for this style
+    auto& spriteStore = *FaderSpriteStore::getInstance();
+    if (!spriteStore.hasSheet (static_cast<int> (faderStyle)))
         return;  // No spritesheet loaded for this style
     
     // Get slider bounds
@@ -609,48 +529,53 @@ void SliderModule::paint (juce::Graphics& g)
                                    juce::roundToInt ((1.0f - normalizedValue) * (totalFrames - 1)));
     }
     
-    // Calculate source Y position in the spritesheet
-    // Frames are stacked vertically from top (frame 0) to bottom (last frame)
-    int srcY = frameIndex * styleInfo.spritesheetFrameHeight;
-    
     // Destination bounds (scale down from 4x to 1x)
     float fillX = (float)sliderBounds.getX();
     float fillY = (float)sliderBounds.getY();
     
-    // Enable high-quality resampling for smooth 4x downscaling
-    g.setImageResamplingQuality (juce::Graphics::highResamplingQuality);
+    // For horizontal sliders: display width = trackHeight (travel), display height = trackWidth (short)
+    // For vertical sliders: display width = trackWidth, display height = trackHeight
+    int fillWidth = (int)(styleInfo.isHorizontal ? styleInfo.trackHeight : styleInfo.trackWidth);
+    int fillHeight = (int)(styleInfo.isHorizontal ? styleInfo.trackWidth : styleInfo.trackHeight);
     
-    // Get the pre-tinted variant for this slider's accent color (instant lookup!)
-    const auto& spritesheetToUse = getVariantForColor (accentColour);
+    // Frames are fetched at the physical pixel size they cover (crisp on Retina, cached across repaints)
+    const float pixelScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    const juce::Point<int> frameSize (juce::roundToInt ((float)fillWidth * pixelScale),
+                                      juce::roundToInt ((float)fillHeight * pixelScale));
+    const auto sheetKey = getSheetKey (fillBarTint);
     
-    // Apply inactive alpha if slider is disabled
-    float drawAlpha = sliderEnabled ? 1.0f : ColorPalette::inactiveFillBarAlpha;
+    // Mid-resize: stretch frames at the size already prepared (cheap, cached) rather than
+    // resampling for every intermediate size
+    const bool stretchPreparedFrames = resizePreview && preparedFrameSize.x > 0 && frameSize != preparedFrameSize;
     
-    // Draw the pre-tinted spritesheet frame
-    // For horizontal sliders: display width = trackHeight (travel), display height = trackWidth (short)
-    // For vertical sliders: display width = trackWidth, display height = trackHeight
-    if (styleInfo.isHorizontal)
+    // First paint at a new scale or color: have every frame resampled to this size in the background
+    // (until then frames are resampled one at a time as they are drawn)
+    if (frameSize != preparedFrameSize && !stretchPreparedFrames)
     {
-        // Horizontal slider: trackHeight is the travel dimension (84), trackWidth is short dimension (28)
-        // Display as: 84 wide × 28 tall
-        g.setOpacity (drawAlpha);
-        g.drawImage (spritesheetToUse,
-                    (int)fillX, (int)fillY, (int)styleInfo.trackHeight, (int)styleInfo.trackWidth,
-                    0, srcY, styleInfo.spritesheetFrameWidth, styleInfo.spritesheetFrameHeight,
-                    false);
-        g.setOpacity (1.0f);  // Reset opacity
-    }
-    else
-    {
-        // Vertical slider: normal orientation
-        g.setOpacity (drawAlpha);
-        g.drawImage (spritesheetToUse,
-                    (int)fillX, (int)fillY, (int)styleInfo.trackWidth, (int)styleInfo.trackHeight,
-                    0, srcY, styleInfo.spritesheetFrameWidth, styleInfo.spritesheetFrameHeight,
-                    false);
-        g.setOpacity (1.0f);  // Reset opacity
+        preparedFrameSize = frameSize;
+        spriteStore.prepareScaledFrames (sheetKey, frameSize.x, frameSize.y);
     }
     
+    const auto drawSize = stretchPreparedFrames ? preparedFrameSize : frameSize;
+    auto frame = spriteStore.getFrame (sheetKey, frameIndex, drawSize.x, drawSize.y);
+    
+    if (stretchPreparedFrames)
+        g.setImageResamplingQuality (juce::Graphics::lowResamplingQuality);
+    
+    // Apply inactive alpha if slider is disabled
+    float drawAlpha = sliderEnabled ? 1.0f : ColorPalette::inactiveFillBarAlpha;
+    
+    // Draw the pre-tinted frame: it already matches the physical pixel size, so this is a 1:1 blit
+    // (except during a resize preview)
+    g.setOpacity (drawAlpha);
+    g.drawImage (frame,
+                 { fillX, fillY, (float)fillWidth, (float)fillHeight },
+                 juce::RectanglePlacement::stretchToFit);
+    g.setOpacity (1.0f);  // Reset opacity
+    
+    if (stretchPreparedFrames)
+        g.setImageResamplingQuality (juce::Graphics::mediumResamplingQuality);  // JUCE default
+    
     // Draw debug border if enabled
     if (showDebugBorder)
     {
@@ -667,10 +592,7 @@ void SliderModule::paint (juce::Graphics& g)
         bounds.removeFromBottom ((int)componentPaddingBottom());
         auto labelBounds = bounds.removeFromBottom ((int)labelHeight());
         
-        // Create a TextLayout from the AttributedString
-        // Use a very large width to prevent any word wrapping - single line only
-        juce::TextLayout layout;
-        layout.createLayout (attributedLabel, 10000.0f);  // Large width = no wrapping
+        const auto& layout = attributedLabelLayout;
         
         // Draw centered in the label bounds
         float textWidth = layout.getWidth();
@@ -695,8 +617,7 @@ void SliderModule::paint (juce::Graphics& g)
         float iconGap = 2.0f * currentScaleFactor;
         
         // Get the width of the label text to position icon to its right
-        auto labelFont = juce::Font (juce::FontOptions (labelFontSize()));
-        float labelTextWidth = labelFont.getStringWidthFloat (parameterName);
+        float labelTextWidth = TextLayoutCache::getInstance()->getStringWidth (parameterName, labelFontSize(), juce::Font::plain);
         
         // Center point of the label
         float labelCenterX = labelBounds.getCentreX();
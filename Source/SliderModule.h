@@ -4,6 +4,7 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include "ColorPalette.h"
 #include "SyncNoteValue.h"
+#include "FaderSpriteStore.h"
 
 //==============================================================================
 // Forward declaration
@@ -35,7 +36,7 @@ private:
  * Each style corresponds to a folder in assets/ containing:
  *   - [FolderName]_frame.svg      → Track background (slot/groove)
  *   - [FolderName]_sprite_sheet.png → Animated fill bar with thumb (4x resolution, vertical strip)
- *   - [FolderName]_color0-9.png   → Pre-tinted color variants (auto-generated if missing)
+ *     (color variants are tinted from it in memory, see FaderSpriteStore)
  * 
  * Naming convention: Fader_[width]x[height][_variant]
  *   - Width is the track width in pixels (unscaled)
@@ -123,10 +124,10 @@ struct FaderStyleInfo
  * 
  * Features:
  * - SVG-based track and thumb rendering (via CustomLookAndFeel)
- * - PNG spritesheet-based animated fill bar
+ * - PNG spritesheet-based animated fill bar (stored compactly, see FaderSpriteStore)
  * - Parameter name label below/beside slider
  * - Value display inside thumb (moves with slider)
- * - Customizable accent color with pre-cached color variants
+ * - Customizable accent color (tinted variants shared process-wide)
  * - Dynamic parameter reassignment (useful for context-switching UIs)
  * - Multiple fader sizes and orientations
  * 
@@ -146,12 +147,6 @@ public:
     /** Get dimension and asset info for a given fader style */
     static FaderStyleInfo getStyleInfo (FaderStyle style);
     
-    /** Get the assets base path */
-    static juce::String getAssetsBasePath()
-    {
-        return "/Users/alistairkerley/Documents/xCode Developments/AKSurroundDelay/assets";
-    }
-    
     /** Get ideal width for a given fader style at 1.0x scale (static convenience method) */
     static int getIdealWidthForStyle (FaderStyle style)
     {
@@ -359,14 +354,25 @@ public:
     /** Detach from current parameter (slider becomes inactive) */
     void detachFromParameter();
     
+    /**
+     * Temporarily stop following the attached parameter (e.g. while hidden), so
+     * automation no longer costs message-thread work for this slider. Resuming
+     * re-attaches and picks up the parameter's current value.
+     */
+    void setParameterAttachmentSuspended (bool shouldBeSuspended);
+    
+    /**
+     * While a window resize is in progress, stretch the fill bar frames already
+     * prepared instead of starting a background resample for every intermediate
+     * size. Ending the preview repaints at the settled size.
+     */
+    void setResizePreview (bool shouldPreview);
+    
     //==========================================================================
     // CUSTOMIZATION
     //==========================================================================
-    /** Set a custom accent color for this slider (future: could tint track/thumb) */
-    void setAccentColour (juce::Colour colour) 
-    { 
-        accentColour = colour; 
-    }
+    /** Set a custom accent color for this slider (tints the fill bar with the nearest palette color) */
+    void setAccentColour (juce::Colour colour);
     
     /** Get the current accent color */
     juce::Colour getAccentColour() const { return accentColour; }
@@ -560,6 +566,7 @@ private:
     juce::String valueSuffix;           // Unit suffix for value display (e.g., "dB", "ms", "%")
     int valueDecimalPlaces = 1;         // Decimal precision for value display (default: 2)
     juce::Colour accentColour {0xffffffff};  /* #ffffff */ // Custom accent color (white default)
+    juce::Colour fillBarTint {0xffffffff};   /* #ffffff */ // Nearest palette color to accentColour (resolved when set)
     juce::Colour valueTextColour {0xffcccccc};  /* #cccccc */ // Custom text color (light grey default)
     bool showDebugBorder = false;       // Show debug border around component bounds
     ValueDisplayMode valueDisplayMode = ValueDisplayMode::Standard;  // How to format/display the value
@@ -574,22 +581,20 @@ private:
     float customLabelHeight = -1.0f;    // Per-instance label height override (-1 = use default)
     juce::Justification labelJustification {juce::Justification::centred};  // Label text justification
     juce::AttributedString attributedLabel;  // Rich text label (used when useAttributedLabel=true)
+    juce::TextLayout attributedLabelLayout;  // attributedLabel laid out once, when it is set
     
     // Text editor for manual value entry (double-click to activate)
     std::unique_ptr<juce::TextEditor> valueTextEditor;
     bool isEditingValue = false;
     
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> attachment;
+    juce::AudioProcessorValueTreeState* attachedState = nullptr;  // Kept so a suspended attachment can resume
     
-    // Fill bar images per style (loaded once, shared by instances of same style)
-    // Key = FaderStyle enum value
-    static std::map<FaderStyle, juce::Image> fillBarImages;
-    static std::map<FaderStyle, bool> fillBarImagesLoaded;
-    
-    // Pre-generated color variants per style
-    // Key = {FaderStyle, colorIndex}
-    static std::map<std::pair<FaderStyle, int>, juce::Image> colorVariants;
-    static std::map<FaderStyle, bool> colorVariantsLoaded;
+    // Fill bar sprite sheets and their color variants live in FaderSpriteStore
+    // (loaded once per style, shared by all instances of the same style)
+    FaderSpriteStore::SheetKey getSheetKey (juce::Colour tint) const { return { static_cast<int> (faderStyle), tint.getARGB() }; }
+    juce::Point<int> preparedFrameSize;  // Physical size pre-resampled frames were last requested at
+    bool resizePreview = false;          // Draw frames at preparedFrameSize, stretched (see setResizePreview)
     
     //==========================================================================\n    // SYNC ICON MEMBERS
     //==========================================================================
@@ -605,9 +610,7 @@ private:
     // HELPER METHODS
     //==========================================================================
     void loadFillBarForStyle();  // Load fill bar spritesheet for this slider's style
-    void loadColorVariantsForStyle();  // Load all pre-cached color variants for this style
-    void generateColorVariantCacheForStyle();  // Generate and save color variants for this style
-    const juce::Image& getVariantForColor (const juce::Colour& colour) const;  // Get nearest variant for this style
+    juce::Colour getVariantForColor (const juce::Colour& colour) const;  // Nearest palette color (the tint to draw with)
     
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SliderModule)
 };
@@ -0,0 +1,268 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <juce_events/juce_events.h>
+#include <array>
+#include <atomic>
+
+//==============================================================================
+/**
+ * Audio-thread stage profiling
+ *
+ * Scoped timers around each DSP stage accumulate per host block. Once per
+ * reporting window the audio thread publishes min/mean/p99/max per stage
+ * behind a sequence counter, so readers (editor overlay, standalone console)
+ * never block it.
+ *
+ * Compiled in for debug builds; define TAPMATRIX_PROFILING=1 to enable it
+ * in a release build. When disabled, TAPMATRIX_PROFILE_STAGE expands to
+ * nothing and none of the classes below exist.
+ */
+#ifndef TAPMATRIX_PROFILING
+ #define TAPMATRIX_PROFILING JUCE_DEBUG
+#endif
+
+#if TAPMATRIX_PROFILING
+
+namespace StageProfiling
+{
+    enum Stage
+    {
+        inputRouting = 0,
+        taps,
+        crosstalk,
+        panning,
+        globalFilters,
+        ducking,
+        dryWetMix,
+        numStages
+    };
+
+    static constexpr const char* stageNames[numStages] =
+        { "Input routing", "Taps", "Crosstalk", "Panning", "Global filters", "Ducking", "Dry/wet mix" };
+
+    /** Per-stage time per host block over one reporting window (microseconds) */
+    struct StageStats
+    {
+        float minMicros = 0.0f;
+        float meanMicros = 0.0f;
+        float p99Micros = 0.0f;
+        float maxMicros = 0.0f;
+    };
+
+    using Report = std::array<StageStats, numStages>;
+
+    //==========================================================================
+    class Profiler
+    {
+    public:
+        Profiler()
+            : microsPerTick (1.0e6 / static_cast<double> (juce::Time::getHighResolutionTicksPerSecond()))
+        {
+        }
+
+        // Audio thread ---------------------------------------------------------
+        void addTicks (Stage stage, juce::int64 ticks) noexcept { blockTicks[stage] += ticks; }
+
+        /** Fold this block's stage times into the window; publish when the window is full */
+        void endBlock (int numSamples, double sampleRate) noexcept
+        {
+            for (int stage = 0; stage < numStages; ++stage)
+            {
+                addToWindow (windows[stage], static_cast<float> (static_cast<double> (blockTicks[stage]) * microsPerTick));
+                blockTicks[stage] = 0;
+            }
+
+            windowSamples += numSamples;
+            if (windowSamples >= static_cast<int> (sampleRate * reportIntervalSeconds))
+                publish();
+        }
+
+        // Any thread -----------------------------------------------------------
+        /** Copy the latest published report; false if none has been published yet */
+        bool getReport (Report& report) const noexcept
+        {
+            for (;;)
+            {
+                const auto before = sequence.load (std::memory_order_acquire);
+                if (before == 0)
+                    return false;
+
+                if ((before & 1) == 0)
+                {
+                    for (int stage = 0; stage < numStages; ++stage)
+                    {
+                        auto& published = publishedStats[static_cast<size_t> (stage)];
+                        report[static_cast<size_t> (stage)] = { published[0].load (std::memory_order_relaxed),
+                                                                published[1].load (std::memory_order_relaxed),
+                                                                published[2].load (std::memory_order_relaxed),
+                                                                published[3].load (std::memory_order_relaxed) };
+                    }
+
+                    std::atomic_thread_fence (std::memory_order_acquire);
+                    if (sequence.load (std::memory_order_relaxed) == before)
+                        return true;
+                }
+            }
+        }
+
+    private:
+        //======================================================================
+        static constexpr double reportIntervalSeconds = 0.5;
+
+        // p99 from a log histogram: 4 buckets per octave of nanoseconds
+        static constexpr int bucketsPerOctave = 4;
+        static constexpr int numBuckets = 32 * bucketsPerOctave;
+
+        struct Window
+        {
+            float minMicros = 0.0f;
+            float maxMicros = 0.0f;
+            double sumMicros = 0.0;
+            int count = 0;
+            std::array<juce::uint32, numBuckets> histogram {};
+        };
+
+        const double microsPerTick;
+        std::array<juce::int64, numStages> blockTicks {};
+        std::array<Window, numStages> windows;
+        int windowSamples = 0;
+
+        std::atomic<juce::uint32> sequence { 0 };  // Odd while publishing
+        std::array<std::array<std::atomic<float>, 4>, numStages> publishedStats {};
+
+        static int getBucket (float micros) noexcept
+        {
+            const auto nanos = static_cast<juce::uint32> (juce::jlimit (1.0f, 4.0e9f, micros * 1000.0f));
+            const int octave = juce::findHighestSetBit (nanos);
+            const int fraction = octave >= 2 ? static_cast<int> ((nanos >> (octave - 2)) & 3u) : 0;
+            return juce::jmin (numBuckets - 1, octave * bucketsPerOctave + fraction);
+        }
+
+        static float getBucketUpperMicros (int bucket) noexcept
+        {
+            const int octave = bucket / bucketsPerOctave;
+            const int fraction = bucket % bucketsPerOctave;
+            return std::ldexp (1.0f + static_cast<float> (fraction + 1) / bucketsPerOctave, octave) * 0.001f;
+        }
+
+        static void addToWindow (Window& window, float micros) noexcept
+        {
+            window.minMicros = window.count == 0 ? micros : juce::jmin (window.minMicros, micros);
+            window.maxMicros = juce::jmax (window.maxMicros, micros);
+            window.sumMicros += micros;
+            ++window.count;
+            ++window.histogram[static_cast<size_t> (getBucket (micros))];
+        }
+
+        static float getPercentile (const Window& window, double fraction) noexcept
+        {
+            const auto threshold = static_cast<juce::uint32> (std::ceil (fraction * window.count - 1.0e-9));
+            juce::uint32 total = 0;
+
+            for (int bucket = 0; bucket < numBuckets; ++bucket)
+            {
+                total += window.histogram[static_cast<size_t> (bucket)];
+                if (total >= threshold)
+                    return juce::jmin (window.maxMicros, getBucketUpperMicros (bucket));
+            }
+
+            return window.maxMicros;
+        }
+
+        void publish() noexcept
+        {
+            sequence.fetch_add (1, std::memory_order_relaxed);
+            std::atomic_thread_fence (std::memory_order_release);
+
+            for (int stage = 0; stage < numStages; ++stage)
+            {
+                auto& window = windows[static_cast<size_t> (stage)];
+                auto& published = publishedStats[static_cast<size_t> (stage)];
+
+                published[0].store (window.minMicros, std::memory_order_relaxed);
+                published[1].store (window.count > 0 ? static_cast<float> (window.sumMicros / window.count) : 0.0f,
+                                    std::memory_order_relaxed);
+                published[2].store (getPercentile (window, 0.99), std::memory_order_relaxed);
+                published[3].store (window.maxMicros, std::memory_order_relaxed);
+
+                window = {};
+            }
+
+            sequence.fetch_add (1, std::memory_order_release);
+            windowSamples = 0;
+        }
+
+        JUCE_DECLARE_NON_COPYABLE (Profiler)
+    };
+
+    //==========================================================================
+    /** Adds the time spent in its scope to one stage */
+    class ScopedStageTimer
+    {
+    public:
+        ScopedStageTimer (Profiler& p, Stage s) noexcept
+            : profiler (p), stage (s), startTicks (juce::Time::getHighResolutionTicks())
+        {
+        }
+
+        ~ScopedStageTimer() noexcept
+        {
+            profiler.addTicks (stage, juce::Time::getHighResolutionTicks() - startTicks);
+        }
+
+    private:
+        Profiler& profiler;
+        const Stage stage;
+        const juce::int64 startTicks;
+
+        JUCE_DECLARE_NON_COPYABLE (ScopedStageTimer)
+    };
+
+    //==========================================================================
+    /** One line per stage, for the overlay and the console */
+    inline juce::StringArray formatReport (const Report& report)
+    {
+        juce::StringArray lines;
+        lines.add ("Stage (us/block)      min     mean      p99      max");
+
+        for (int stage = 0; stage < numStages; ++stage)
+        {
+            const auto& stats = report[static_cast<size_t> (stage)];
+            lines.add (juce::String (stageNames[stage]).paddedRight (' ', 16)
+                       + juce::String (stats.minMicros, 1).paddedLeft (' ', 9)
+                       + juce::String (stats.meanMicros, 1).paddedLeft (' ', 9)
+                       + juce::String (stats.p99Micros, 1).paddedLeft (' ', 9)
+                       + juce::String (stats.maxMicros, 1).paddedLeft (' ', 9));
+        }
+
+        return lines;
+    }
+
+    //==========================================================================
+    /** Logs the latest report periodically (standalone app console) */
+    class ConsoleReporter : private juce::Timer
+    {
+    public:
+        explicit ConsoleReporter (const Profiler& p) : profiler (p) { startTimer (2000); }
+        ~ConsoleReporter() override { stopTimer(); }
+
+    private:
+        const Profiler& profiler;
+
+        void timerCallback() override
+        {
+            Report report;
+            if (profiler.getReport (report))
+                juce::Logger::writeToLog (formatReport (report).joinIntoString ("\n"));
+        }
+
+        JUCE_DECLARE_NON_COPYABLE (ConsoleReporter)
+    };
+}
+
+ #define TAPMATRIX_PROFILE_STAGE(profiler, stage) \
+    const StageProfiling::ScopedStageTimer JUCE_JOIN_MACRO (stageTimer_, __LINE__) (profiler, StageProfiling::stage)
+#else
+ #define TAPMATRIX_PROFILE_STAGE(profiler, stage)
+#endif
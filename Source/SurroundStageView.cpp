@@ -1,6 +1,9 @@
 #include "SurroundStageView.h"
 #include "ColorPalette.h"
+#include "FrameScheduler.h"
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 
 //==============================================================================
 // Shader source code (GLSL 120 for macOS compatibility)
@@ -27,19 +30,60 @@ const char* SurroundStageView::fragmentShaderSource = R"(
     }
 )";
 
+//==============================================================================
+// Tap puck shaders: one camera-facing quad per instance, cut to a soft disc
+//==============================================================================
+const char* SurroundStageView::puckVertexShaderSource = R"(
+    attribute vec2 aCorner;     // Quad corner, -1 to +1 (per vertex)
+    attribute vec3 aCentre;     // Per instance
+    attribute float aSize;      // Per instance: radius in room units
+    attribute vec4 aColour;     // Per instance
+    
+    uniform mat4 uProjection;
+    uniform mat4 uView;
+    
+    varying vec2 vCorner;
+    varying vec4 vColour;
+    
+    void main()
+    {
+        vec4 viewPos = uView * vec4(aCentre, 1.0);
+        viewPos.xy += aCorner * aSize;
+        gl_Position = uProjection * viewPos;
+        
+        vCorner = aCorner;
+        vColour = aColour;
+    }
+)";
+
+const char* SurroundStageView::puckFragmentShaderSource = R"(
+    varying vec2 vCorner;
+    varying vec4 vColour;
+    
+    void main()
+    {
+        float r = dot(vCorner, vCorner);
+        if (r > 1.0)
+            discard;
+        
+        gl_FragColor = vec4(vColour.rgb, vColour.a * (1.0 - smoothstep(0.7, 1.0, r)));
+    }
+)";
+
 //==============================================================================
 SurroundStageView::SurroundStageView()
 {
     // Attach OpenGL context to this component
     openGLContext.setRenderer (this);
-    openGLContext.setMultisamplingEnabled (true);  // Enable antialiasing
     
-    // Request higher quality pixel format with more multisample samples
-    juce::OpenGLPixelFormat pixelFormat;
-    pixelFormat.multisamplingLevel = 8;  // 8x MSAA for crisp lines
-    openGLContext.setPixelFormat (pixelFormat);
+    // Render only when invalidated; paint() draws nothing, so skip the component overlay too
+    openGLContext.setContinuousRepainting (false);
+    openGLContext.setComponentPaintingEnabled (false);
     
-    openGLContext.attachTo (*this);
+    if (juce::SystemStats::getEnvironmentVariable ("TAPMATRIX_SOFTWARE_3D", {}) == "1")
+        switchToSoftwareRenderer();
+    else
+        attachContext();
     
     // Enable mouse events
     setInterceptsMouseClicks (true, true);
@@ -53,15 +97,99 @@ SurroundStageView::~SurroundStageView()
     openGLContext.detach();
 }
 
+void SurroundStageView::attachContext()
+{
+    // 8x MSAA for crisp lines unless slow frames have stepped it down
+    const int samples = multisamplingLevels[(size_t) multisamplingIndex.load()];
+    
+    juce::OpenGLPixelFormat pixelFormat;
+    pixelFormat.multisamplingLevel = samples;
+    openGLContext.setPixelFormat (pixelFormat);
+    openGLContext.setMultisamplingEnabled (samples > 0);
+    
+    openGLContext.attachTo (*this);
+}
+
+void SurroundStageView::invalidateScene()
+{
+    if (usingSoftwareRenderer)
+        repaint();
+    else
+        openGLContext.triggerRepaint();
+}
+
+//==============================================================================
+// Adaptive Multisampling
+//==============================================================================
+void SurroundStageView::updateMultisampling (double frameMs)
+{
+    if (multisamplingChangePending)
+        return;
+    
+    smoothedFrameMs += 0.2 * (frameMs - smoothedFrameMs);
+    
+    // Levels that proved too slow stay off limits for a while, so the level can't cycle 8x -> 4x -> 8x
+    const double nowMs = juce::Time::getMillisecondCounterHiRes();
+    if (tooSlowMultisamplingIndex >= 0 && nowMs - tooSlowMultisamplingMs > multisamplingRetrySeconds * 1000.0)
+        tooSlowMultisamplingIndex = -1;
+    
+    const int index = multisamplingIndex.load();
+    const bool canStepDown = index < (int) multisamplingLevels.size() - 1;
+    const bool canStepUp = index > tooSlowMultisamplingIndex + 1;
+    
+    slowFrameCount = (smoothedFrameMs > slowFrameMs && canStepDown) ? slowFrameCount + 1 : 0;
+    fastFrameCount = (smoothedFrameMs < fastFrameMs && canStepUp) ? fastFrameCount + 1 : 0;
+    
+    int newIndex = index;
+    if (slowFrameCount >= framesBeforeMultisamplingChange)
+    {
+        newIndex = index + 1;
+        tooSlowMultisamplingIndex = juce::jmax (tooSlowMultisamplingIndex, index);
+        tooSlowMultisamplingMs = nowMs;
+    }
+    else if (fastFrameCount >= framesBeforeMultisamplingChange * 10)  // Much slower to raise than to drop
+        newIndex = index - 1;
+    
+    if (newIndex == index)
+        return;
+    
+    // The pixel format can only change by re-attaching, which must happen on the message thread
+    multisamplingChangePending = true;
+    juce::MessageManager::callAsync ([safeThis = juce::Component::SafePointer<SurroundStageView> (this), newIndex]
+    {
+        if (safeThis != nullptr)
+            safeThis->setMultisamplingIndex (newIndex);
+    });
+}
+
+void SurroundStageView::setMultisamplingIndex (int index)
+{
+    // Detaching stops the render thread, so its frame timing is safe to read afterwards
+    openGLContext.detach();
+    DBG ("SurroundStageView: " << multisamplingLevels[(size_t) index] << "x MSAA (smoothed frame time "
+         << smoothedFrameMs << " ms)");
+    
+    multisamplingIndex = index;
+    attachContext();
+}
+
 //==============================================================================
 // OpenGL Renderer Callbacks
 //==============================================================================
 void SurroundStageView::newOpenGLContextCreated()
 {
+    // Frame timing starts over with each context (and multisampling level)
+    smoothedFrameMs = 0.0;
+    slowFrameCount = 0;
+    fastFrameCount = 0;
+    multisamplingChangePending = false;
+    contextCreated = true;
+    
     // Create shaders
     if (!createShaders())
     {
         DBG ("Failed to create shaders!");
+        contextFailed = true;  // The message thread switches to the software renderer
         return;
     }
     
@@ -69,11 +197,15 @@ void SurroundStageView::newOpenGLContextCreated()
     attribPosition = juce::gl::glGetAttribLocation (shaderProgram->getProgramID(), "aPos");
     
     // Create geometry
-    createRoomWallsGeometry();
-    createRoomEdgesGeometry();
-    createGridGeometry();
-    createSphereGeometry();
-    createFrontLabelGeometry();
+    roomWallsVBO = createVertexBuffer (createRoomWallsGeometry(), roomWallsVertexCount);
+    roomEdgesVBO = createVertexBuffer (createRoomEdgesGeometry(), roomEdgesVertexCount);
+    gridVBO = createVertexBuffer (createGridGeometry(), gridVertexCount);
+    sphereVBO = createVertexBuffer (createSphereGeometry(), sphereVertexCount);
+    frontLabelVBO = createVertexBuffer (createFrontLabelGeometry(), frontLabelVertexCount);
+    
+    // Tap pucks (the room still draws if these fail)
+    if (createPuckShaders())
+        createTapInstanceBuffers();
     
     // Enable depth testing
     juce::gl::glEnable (juce::gl::GL_DEPTH_TEST);
@@ -87,11 +219,14 @@ void SurroundStageView::newOpenGLContextCreated()
     juce::gl::glHint (juce::gl::GL_LINE_SMOOTH_HINT, juce::gl::GL_NICEST);
     
     // Enable multisampling
-    juce::gl::glEnable (juce::gl::GL_MULTISAMPLE);
+    if (multisamplingLevels[(size_t) multisamplingIndex.load()] > 0)
+        juce::gl::glEnable (juce::gl::GL_MULTISAMPLE);
 }
 
 void SurroundStageView::renderOpenGL()
 {
+    const auto frameStartMs = juce::Time::getMillisecondCounterHiRes();
+    
     // Clear with viewport background color
     juce::gl::glClearColor (ColorPalette::viewport3DBackground.r, 
                             ColorPalette::viewport3DBackground.g, 
@@ -207,12 +342,22 @@ void SurroundStageView::renderOpenGL()
     // Disable vertex attribute
     juce::gl::glDisableVertexAttribArray ((GLuint)attribPosition);
     juce::gl::glBindBuffer (juce::gl::GL_ARRAY_BUFFER, 0);
+    
+    //==========================================================================
+    // Tap pucks and echo trails (one draw call)
+    drawTapInstances (projection, view);
+    
+    // Wait for the GPU so the measured time includes the multisampled fill
+    // (frames are rare now, and this is the render thread, not the message thread)
+    juce::gl::glFinish();
+    updateMultisampling (juce::Time::getMillisecondCounterHiRes() - frameStartMs);
 }
 
 void SurroundStageView::openGLContextClosing()
 {
-    // Clean up shader
+    // Clean up shaders
     shaderProgram.reset();
+    puckShaderProgram.reset();
     
     // Clean up VBOs
     if (roomWallsVBO != 0)
@@ -235,6 +380,15 @@ void SurroundStageView::openGLContextClosing()
     gridVBO = 0;
     sphereVBO = 0;
     frontLabelVBO = 0;
+    
+    if (puckCornerVBO != 0)
+        juce::gl::glDeleteBuffers (1, &puckCornerVBO);
+    
+    if (tapInstanceVBO != 0)
+        juce::gl::glDeleteBuffers (1, &tapInstanceVBO);
+    
+    puckCornerVBO = 0;
+    tapInstanceVBO = 0;
 }
 
 //==============================================================================
@@ -242,8 +396,9 @@ void SurroundStageView::openGLContextClosing()
 //==============================================================================
 void SurroundStageView::paint (juce::Graphics& g)
 {
-    // OpenGL handles all rendering, but we can draw overlays here if needed
-    juce::ignoreUnused (g);
+    // OpenGL handles all rendering unless it's unavailable
+    if (usingSoftwareRenderer)
+        paintSoftware (g);
 }
 
 void SurroundStageView::resized()
@@ -276,8 +431,8 @@ void SurroundStageView::mouseDrag (const juce::MouseEvent& event)
     
     currentPreset = ViewPreset::Custom;
     
-    // Trigger repaint
-    repaint();
+    // Render the new camera angle
+    invalidateScene();
 }
 
 void SurroundStageView::mouseWheelMove (const juce::MouseEvent& event, const juce::MouseWheelDetails& wheel)
@@ -287,7 +442,7 @@ void SurroundStageView::mouseWheelMove (const juce::MouseEvent& event, const juc
     zoom -= wheel.deltaY * 0.5f;
     zoom = juce::jlimit (minZoom, maxZoom, zoom);
     
-    repaint();
+    invalidateScene();
 }
 
 //==============================================================================
@@ -344,26 +499,23 @@ void SurroundStageView::setViewPreset (ViewPreset preset)
     animationTargetElevation = targetElevation;
     animationProgress = 0.0f;
     isAnimating = true;
-    
-    startTimerHz (60);  // 60 FPS animation
+    secondsSinceAnimationFrame = animationFrameSeconds;  // Render the first step straight away
 }
 
-void SurroundStageView::timerCallback()
+void SurroundStageView::advanceAnimation (double elapsedSeconds)
 {
+    checkRenderer (elapsedSeconds);
+    
     if (!isAnimating)
-    {
-        stopTimer();
         return;
-    }
     
     // Smooth easing animation
-    animationProgress += animationSpeed;
+    animationProgress += animationSpeed * FrameScheduler::getFrameSteps (elapsedSeconds);
     
     if (animationProgress >= 1.0f)
     {
         animationProgress = 1.0f;
         isAnimating = false;
-        stopTimer();
     }
     
     // Ease-out cubic
@@ -380,13 +532,495 @@ void SurroundStageView::timerCallback()
     
     elevation = animationStartElevation + (animationTargetElevation - animationStartElevation) * t;
     
+    // Render at a low fixed rate while moving, and always the final position
+    secondsSinceAnimationFrame += elapsedSeconds;
+    if (secondsSinceAnimationFrame >= animationFrameSeconds || !isAnimating)
+    {
+        secondsSinceAnimationFrame = 0.0;
+        invalidateScene();
+    }
+}
+
+//==============================================================================
+// Tap Pucks
+//==============================================================================
+void SurroundStageView::setTapSource (juce::AudioProcessorValueTreeState& apvts, std::function<float (int)> tapLevelSource)
+{
+    for (int i = 0; i < numTaps; ++i)
+    {
+        auto& tap = tapStates[(size_t) i];
+        const juce::String suffix (i + 1);
+        
+        tap.gain = apvts.getRawParameterValue ("gain" + suffix);
+        tap.feedback = apvts.getRawParameterValue ("feedback" + suffix);
+        tap.panX = apvts.getRawParameterValue ("panX" + suffix);
+        tap.panY = apvts.getRawParameterValue ("panY" + suffix);
+        tap.panZ = apvts.getRawParameterValue ("panZ" + suffix);
+        tap.colour = ColorPalette::palettePairs[i % ColorPalette::paletteSize].background;
+    }
+    
+    getTapLevel = std::move (tapLevelSource);
+}
+
+SurroundStageView::TapInstance SurroundStageView::makeTapInstance (juce::Vector3D<float> position, float size,
+                                                                   juce::Colour colour, float alpha)
+{
+    return { position.x, position.y, position.z, size,
+             colour.getFloatRed(), colour.getFloatGreen(), colour.getFloatBlue(), alpha };
+}
+
+void SurroundStageView::updateTaps (double elapsedSeconds)
+{
+    if (getTapLevel == nullptr)
+        return;
+    
+    bool sceneChanged = false;
+    
+    // Trails first so the pucks draw over them
+    std::array<TapInstance, maxTapInstances> instances;
+    std::array<TapInstance, numTaps> pucks;
+    int numInstances = 0;
+    int numPucks = 0;
+    
+    for (int i = 0; i < numTaps; ++i)
+    {
+        auto& tap = tapStates[(size_t) i];
+        if (tap.gain == nullptr || tap.feedback == nullptr || tap.panX == nullptr || tap.panY == nullptr || tap.panZ == nullptr)
+            continue;
+        
+        // Pan X/Y span the floor; height runs from floor to ceiling
+        const juce::Vector3D<float> position (tap.panX->load(), tap.panY->load(),
+                                              -halfHeight + tap.panZ->load() * roomHeight);
+        const bool active = tap.gain->load() > inactiveGainDb;
+        const float level = juce::jlimit (0.0f, 1.0f, getTapLevel (i));
+        const float size = puckRadius + puckLevelRadius * level;
+        
+        // Re-render only for visible changes (meter jitter below ~1/1000 of the room is ignored)
+        if ((position - tap.position).length() > 0.001f || std::abs (size - tap.size) > 0.001f || active != tap.active)
+            sceneChanged = true;
+        
+        tap.position = position;
+        tap.size = size;
+        tap.active = active;
+        
+        // Age the echo trail: more feedback, longer trail
+        const float trailSeconds = trailBaseSeconds + trailFeedbackSeconds * tap.feedback->load();
+        
+        for (auto& point : tap.trail)
+        {
+            if (point.alpha <= 0.0f)
+                continue;
+            
+            point.age += (float) elapsedSeconds;
+            point.alpha = trailStartAlpha * std::exp (-point.age / trailSeconds);
+            if (point.alpha < minTrailAlpha)
+                point.alpha = 0.0f;
+            
+            sceneChanged = true;
+            instances[(size_t) numInstances++] = makeTapInstance (point.position, point.size, tap.colour, point.alpha);
+        }
+        
+        // A moving puck leaves trail points behind it
+        if (!tap.hasTrailPosition || !active)
+        {
+            tap.lastTrailPosition = position;
+            tap.hasTrailPosition = true;
+        }
+        else if ((position - tap.lastTrailPosition).length() > trailSpacing)
+        {
+            tap.trail[(size_t) tap.nextTrailPoint] = { tap.lastTrailPosition, size * 0.7f, 0.0f, trailStartAlpha };
+            tap.nextTrailPoint = (tap.nextTrailPoint + 1) % trailLength;
+            tap.lastTrailPosition = position;
+            sceneChanged = true;
+        }
+        
+        pucks[(size_t) numPucks++] = makeTapInstance (position, size, tap.colour, active ? 1.0f : inactivePuckAlpha);
+    }
+    
+    std::copy_n (pucks.begin(), numPucks, instances.begin() + numInstances);
+    numInstances += numPucks;
+    
+    if (!sceneChanged)
+        return;
+    
+    {
+        const juce::SpinLock::ScopedLockType lock (tapInstanceLock);
+        std::copy_n (instances.begin(), numInstances, publishedTapInstances.begin());
+        numPublishedTapInstances = numInstances;
+    }
+    
+    invalidateScene();
+}
+
+bool SurroundStageView::createPuckShaders()
+{
+    puckShaderProgram = std::make_unique<juce::OpenGLShaderProgram> (openGLContext);
+    
+    if (!puckShaderProgram->addVertexShader (puckVertexShaderSource)
+        || !puckShaderProgram->addFragmentShader (puckFragmentShaderSource)
+        || !puckShaderProgram->link())
+    {
+        DBG ("Puck shader error: " << puckShaderProgram->getLastError());
+        puckShaderProgram.reset();
+        return false;
+    }
+    
+    const auto programID = puckShaderProgram->getProgramID();
+    puckUniformProjection = juce::gl::glGetUniformLocation (programID, "uProjection");
+    puckUniformView = juce::gl::glGetUniformLocation (programID, "uView");
+    puckAttribCorner = juce::gl::glGetAttribLocation (programID, "aCorner");
+    puckAttribCentre = juce::gl::glGetAttribLocation (programID, "aCentre");
+    puckAttribSize = juce::gl::glGetAttribLocation (programID, "aSize");
+    puckAttribColour = juce::gl::glGetAttribLocation (programID, "aColour");
+    
+    if (puckAttribCorner < 0 || puckAttribCentre < 0 || puckAttribSize < 0 || puckAttribColour < 0)
+    {
+        puckShaderProgram.reset();
+        return false;
+    }
+    
+    return true;
+}
+
+void SurroundStageView::createTapInstanceBuffers()
+{
+    // Instancing needs GL 3.3 / ARB_instanced_arrays, which legacy macOS contexts may not expose
+    useInstancing = juce::gl::glDrawArraysInstanced != nullptr && juce::gl::glVertexAttribDivisor != nullptr;
+    
+    size_t instanceBufferBytes = 0;
+    
+    if (useInstancing)
+    {
+        const float corners[] = { -1.0f, -1.0f,   1.0f, -1.0f,   1.0f, 1.0f,
+                                  -1.0f, -1.0f,   1.0f,  1.0f,  -1.0f, 1.0f };
+        
+        juce::gl::glGenBuffers (1, &puckCornerVBO);
+        juce::gl::glBindBuffer (juce::gl::GL_ARRAY_BUFFER, puckCornerVBO);
+        juce::gl::glBufferData (juce::gl::GL_ARRAY_BUFFER, sizeof (corners), corners, juce::gl::GL_STATIC_DRAW);
+        
+        instanceBufferBytes = maxTapInstances * sizeof (TapInstance);
+    }
+    else
+    {
+        // Corner (2 floats) + instance data per vertex, 6 vertices per quad
+        instanceBufferBytes = maxTapInstances * 6 * (2 * sizeof (float) + sizeof (TapInstance));
+        expandedTapVertices.reserve (instanceBufferBytes / sizeof (float));
+    }
+    
+    // Fixed size: cost doesn't grow with the number of visible echoes
+    juce::gl::glGenBuffers (1, &tapInstanceVBO);
+    juce::gl::glBindBuffer (juce::gl::GL_ARRAY_BUFFER, tapInstanceVBO);
+    juce::gl::glBufferData (juce::gl::GL_ARRAY_BUFFER, (GLsizeiptr) instanceBufferBytes, nullptr, juce::gl::GL_DYNAMIC_DRAW);
+    juce::gl::glBindBuffer (juce::gl::GL_ARRAY_BUFFER, 0);
+}
+
+void SurroundStageView::drawTapInstances (const juce::Matrix3D<float>& projection, const juce::Matrix3D<float>& view)
+{
+    if (puckShaderProgram == nullptr || tapInstanceVBO == 0)
+        return;
+    
+    int numInstances = 0;
+    {
+        const juce::SpinLock::ScopedLockType lock (tapInstanceLock);
+        numInstances = numPublishedTapInstances;
+        std::copy_n (publishedTapInstances.begin(), numInstances, renderTapInstances.begin());
+    }
+    
+    if (numInstances == 0)
+        return;
+    
+    puckShaderProgram->use();
+    juce::gl::glUniformMatrix4fv (puckUniformProjection, 1, juce::gl::GL_FALSE, projection.mat);
+    juce::gl::glUniformMatrix4fv (puckUniformView, 1, juce::gl::GL_FALSE, view.mat);
+    
+    const GLuint instanceAttribs[] = { (GLuint) puckAttribCentre, (GLuint) puckAttribSize, (GLuint) puckAttribColour };
+    const GLint instanceAttribSizes[] = { 3, 1, 4 };
+    const size_t instanceAttribOffsets[] = { offsetof (TapInstance, x), offsetof (TapInstance, size), offsetof (TapInstance, r) };
+    
+    auto setInstanceAttributes = [&] (GLsizei stride, size_t baseOffset)
+    {
+        for (size_t i = 0; i < 3; ++i)
+        {
+            juce::gl::glEnableVertexAttribArray (instanceAttribs[i]);
+            juce::gl::glVertexAttribPointer (instanceAttribs[i], instanceAttribSizes[i], juce::gl::GL_FLOAT, juce::gl::GL_FALSE,
+                                             stride, reinterpret_cast<const void*> (baseOffset + instanceAttribOffsets[i]));
+        }
+    };
+    
+    // Markers stay visible through the room walls
+    juce::gl::glDisable (juce::gl::GL_DEPTH_TEST);
+    juce::gl::glEnableVertexAttribArray ((GLuint) puckAttribCorner);
+    juce::gl::glBindBuffer (juce::gl::GL_ARRAY_BUFFER, tapInstanceVBO);
+    
+    if (useInstancing)
+    {
+        juce::gl::glBufferSubData (juce::gl::GL_ARRAY_BUFFER, 0, (GLsizeiptr) (numInstances * sizeof (TapInstance)),
+                                   renderTapInstances.data());
+        setInstanceAttributes (sizeof (TapInstance), 0);
+        
+        for (auto attrib : instanceAttribs)
+            juce::gl::glVertexAttribDivisor (attrib, 1);
+        
+        juce::gl::glBindBuffer (juce::gl::GL_ARRAY_BUFFER, puckCornerVBO);
+        juce::gl::glVertexAttribPointer ((GLuint) puckAttribCorner, 2, juce::gl::GL_FLOAT, juce::gl::GL_FALSE, 0, nullptr);
+        
+        juce::gl::glDrawArraysInstanced (juce::gl::GL_TRIANGLES, 0, 6, numInstances);
+        
+        // Attribute state is global without a VAO: don't leave divisors behind for the room shader
+        for (auto attrib : instanceAttribs)
+            juce::gl::glVertexAttribDivisor (attrib, 0);
+    }
+    else
+    {
+        static constexpr float corners[6][2] = { { -1.0f, -1.0f }, { 1.0f, -1.0f }, { 1.0f, 1.0f },
+                                                 { -1.0f, -1.0f }, { 1.0f,  1.0f }, { -1.0f, 1.0f } };
+        
+        expandedTapVertices.clear();
+        for (int i = 0; i < numInstances; ++i)
+        {
+            const auto& instance = renderTapInstances[(size_t) i];
+            for (const auto& corner : corners)
+                expandedTapVertices.insert (expandedTapVertices.end(),
+                                            { corner[0], corner[1], instance.x, instance.y, instance.z,
+                                              instance.size, instance.r, instance.g, instance.b, instance.a });
+        }
+        
+        juce::gl::glBufferSubData (juce::gl::GL_ARRAY_BUFFER, 0, (GLsizeiptr) (expandedTapVertices.size() * sizeof (float)),
+                                   expandedTapVertices.data());
+        
+        const GLsizei stride = 2 * sizeof (float) + sizeof (TapInstance);
+        juce::gl::glVertexAttribPointer ((GLuint) puckAttribCorner, 2, juce::gl::GL_FLOAT, juce::gl::GL_FALSE, stride, nullptr);
+        setInstanceAttributes (stride, 2 * sizeof (float));
+        
+        juce::gl::glDrawArrays (juce::gl::GL_TRIANGLES, 0, numInstances * 6);
+    }
+    
+    juce::gl::glDisableVertexAttribArray ((GLuint) puckAttribCorner);
+    for (auto attrib : instanceAttribs)
+        juce::gl::glDisableVertexAttribArray (attrib);
+    
+    juce::gl::glBindBuffer (juce::gl::GL_ARRAY_BUFFER, 0);
+    juce::gl::glEnable (juce::gl::GL_DEPTH_TEST);
+}
+
+//==============================================================================
+// Software Fallback
+//==============================================================================
+namespace
+{
+    /** a * b for column-major 4x4 matrices, as the shaders multiply them */
+    juce::Matrix3D<float> multiplyColumnMajor (const juce::Matrix3D<float>& a, const juce::Matrix3D<float>& b)
+    {
+        juce::Matrix3D<float> result;
+        
+        for (int column = 0; column < 4; ++column)
+            for (int row = 0; row < 4; ++row)
+            {
+                float sum = 0.0f;
+                for (int k = 0; k < 4; ++k)
+                    sum += a.mat[k * 4 + row] * b.mat[column * 4 + k];
+                
+                result.mat[column * 4 + row] = sum;
+            }
+        
+        return result;
+    }
+    
+    /** Screen position of a room point, or false if it is behind the near plane */
+    bool projectToScreen (const juce::Matrix3D<float>& viewProjection, const float* xyz,
+                          juce::Rectangle<float> bounds, juce::Point<float>& screen)
+    {
+        const auto* m = viewProjection.mat;
+        const float clipX = m[0] * xyz[0] + m[4] * xyz[1] + m[8]  * xyz[2] + m[12];
+        const float clipY = m[1] * xyz[0] + m[5] * xyz[1] + m[9]  * xyz[2] + m[13];
+        const float clipW = m[3] * xyz[0] + m[7] * xyz[1] + m[11] * xyz[2] + m[15];
+        
+        if (clipW <= 0.1f)
+            return false;
+        
+        screen = { bounds.getX() + (clipX / clipW + 1.0f) * 0.5f * bounds.getWidth(),
+                   bounds.getY() + (1.0f - clipY / clipW) * 0.5f * bounds.getHeight() };
+        return true;
+    }
+    
+    /** Project xyz line pairs into one path of separate segments */
+    juce::Path projectLines (const std::vector<float>& vertices, const juce::Matrix3D<float>& viewProjection,
+                             juce::Rectangle<float> bounds)
+    {
+        juce::Path path;
+        juce::Point<float> a, b;
+        
+        for (size_t i = 0; i + 6 <= vertices.size(); i += 6)
+        {
+            if (projectToScreen (viewProjection, &vertices[i], bounds, a)
+                && projectToScreen (viewProjection, &vertices[i + 3], bounds, b))
+            {
+                path.startNewSubPath (a);
+                path.lineTo (b);
+            }
+        }
+        
+        return path;
+    }
+    
+    /** Project xyz triangles into one fillable path */
+    juce::Path projectTriangles (const std::vector<float>& vertices, const juce::Matrix3D<float>& viewProjection,
+                                 juce::Rectangle<float> bounds)
+    {
+        juce::Path path;
+        juce::Point<float> a, b, c;
+        
+        for (size_t i = 0; i + 9 <= vertices.size(); i += 9)
+        {
+            if (projectToScreen (viewProjection, &vertices[i], bounds, a)
+                && projectToScreen (viewProjection, &vertices[i + 3], bounds, b)
+                && projectToScreen (viewProjection, &vertices[i + 6], bounds, c))
+            {
+                path.addTriangle (a, b, c);
+            }
+        }
+        
+        return path;
+    }
+    
+    juce::Colour toColour (const ColorPalette::ViewportColor3D& colour)
+    {
+        return juce::Colour::fromFloatRGBA (colour.r, colour.g, colour.b, colour.a);
+    }
+}
+
+void SurroundStageView::checkRenderer (double elapsedSeconds)
+{
+    if (usingSoftwareRenderer)
+        return;
+    
+    // Context creation is asynchronous and simply never happens where GL is unavailable
+    if (!contextCreated && isShowing())
+        secondsWaitingForContext += elapsedSeconds;
+    
+    if (contextFailed || secondsWaitingForContext >= contextTimeoutSeconds)
+    {
+        DBG ("SurroundStageView: OpenGL unavailable, using the software renderer");
+        switchToSoftwareRenderer();
+    }
+}
+
+void SurroundStageView::switchToSoftwareRenderer()
+{
+    if (openGLContext.isAttached())
+        openGLContext.detach();
+    
+    usingSoftwareRenderer = true;
+    softwareGeometry = { createRoomWallsGeometry(), createRoomEdgesGeometry(), createGridGeometry(),
+                         createSphereGeometry(), createFrontLabelGeometry() };
+    projectedScene.valid = false;
+    
+    setOpaque (true);
     repaint();
 }
 
+void SurroundStageView::updateProjectedScene (const juce::Matrix3D<float>& viewProjection)
+{
+    // Re-project only when the camera or size has changed
+    if (projectedScene.valid && projectedScene.azimuth == azimuth && projectedScene.elevation == elevation
+        && projectedScene.zoom == zoom && projectedScene.bounds == getLocalBounds())
+        return;
+    
+    const auto bounds = getLocalBounds().toFloat();
+    
+    projectedScene.roomWalls = projectTriangles (softwareGeometry.roomWalls, viewProjection, bounds);
+    projectedScene.roomEdges = projectLines (softwareGeometry.roomEdges, viewProjection, bounds);
+    projectedScene.grid = projectLines (softwareGeometry.grid, viewProjection, bounds);
+    projectedScene.sphere = projectTriangles (softwareGeometry.sphere, viewProjection, bounds);
+    projectedScene.frontLabel = projectLines (softwareGeometry.frontLabel, viewProjection, bounds);
+    
+    projectedScene.azimuth = azimuth;
+    projectedScene.elevation = elevation;
+    projectedScene.zoom = zoom;
+    projectedScene.bounds = getLocalBounds();
+    projectedScene.valid = true;
+}
+
+void SurroundStageView::paintSoftware (juce::Graphics& g)
+{
+    const auto startMs = juce::Time::getMillisecondCounterHiRes();
+    
+    g.fillAll (toColour (ColorPalette::viewport3DBackground));
+    
+    if (getWidth() <= 0 || getHeight() <= 0)
+        return;
+    
+    const auto projection = getProjectionMatrix();
+    const auto viewProjection = multiplyColumnMajor (projection, getViewMatrix());
+    updateProjectedScene (viewProjection);
+    
+    // Same order as the GL path, without depth testing
+    g.setColour (toColour (ColorPalette::roomWallsColour));
+    g.fillPath (projectedScene.roomWalls);
+    
+    g.setColour (toColour (ColorPalette::gridColour));
+    g.strokePath (projectedScene.grid, juce::PathStrokeType (1.0f));
+    
+    g.setColour (toColour (ColorPalette::sphereColour));
+    g.fillPath (projectedScene.sphere);
+    
+    g.setColour (toColour (ColorPalette::roomEdgesColour));
+    g.strokePath (projectedScene.roomEdges, juce::PathStrokeType (1.0f));
+    
+    g.setColour (juce::Colour::fromFloatRGBA (0.6f, 0.6f, 0.6f, 1.0f));
+    g.strokePath (projectedScene.frontLabel, juce::PathStrokeType (1.0f));
+    
+    // Tap markers move independently of the camera, so they are projected every paint
+    const auto bounds = getLocalBounds().toFloat();
+    const float pixelsPerUnit = projection.mat[5] * 0.5f * bounds.getHeight();  // At a clip w of 1
+    
+    auto drawMarker = [&] (juce::Vector3D<float> position, float size, juce::Colour colour, float alpha)
+    {
+        const float xyz[] = { position.x, position.y, position.z };
+        const auto* m = viewProjection.mat;
+        const float clipW = m[3] * xyz[0] + m[7] * xyz[1] + m[11] * xyz[2] + m[15];
+        
+        juce::Point<float> centre;
+        if (!projectToScreen (viewProjection, xyz, bounds, centre))
+            return;
+        
+        const float radius = size * pixelsPerUnit / clipW;
+        g.setColour (colour.withAlpha (alpha));
+        g.fillEllipse (juce::Rectangle<float> (radius * 2.0f, radius * 2.0f).withCentre (centre));
+    };
+    
+    for (const auto& tap : tapStates)
+        for (const auto& point : tap.trail)
+            if (point.alpha > 0.0f)
+                drawMarker (point.position, point.size, tap.colour, point.alpha);
+    
+    if (getTapLevel != nullptr)
+        for (const auto& tap : tapStates)
+            drawMarker (tap.position, tap.size, tap.colour, tap.active ? 1.0f : inactivePuckAlpha);
+    
+    lastSoftwareRenderMs = juce::Time::getMillisecondCounterHiRes() - startMs;
+}
+
 //==============================================================================
 // Geometry Generation
 //==============================================================================
-void SurroundStageView::createRoomWallsGeometry()
+GLuint SurroundStageView::createVertexBuffer (const std::vector<float>& vertices, int& vertexCount)
+{
+    vertexCount = (int)(vertices.size() / 3);
+    
+    GLuint vbo = 0;
+    juce::gl::glGenBuffers (1, &vbo);
+    juce::gl::glBindBuffer (juce::gl::GL_ARRAY_BUFFER, vbo);
+    juce::gl::glBufferData (juce::gl::GL_ARRAY_BUFFER, 
+                            (GLsizeiptr)(vertices.size() * sizeof(float)), 
+                            vertices.data(), 
+                            juce::gl::GL_STATIC_DRAW);
+    juce::gl::glBindBuffer (juce::gl::GL_ARRAY_BUFFER, 0);
+    
+    return vbo;
+}
+
+std::vector<float> SurroundStageView::createRoomWallsGeometry()
 {
     // Create solid wall faces (triangles) for proper depth testing
     // 6 faces: floor, ceiling, and 4 walls
@@ -423,19 +1057,10 @@ void SurroundStageView::createRoomWallsGeometry()
     // Right wall (X = +1)
     addQuad(1.0f, -1.0f, -h,  1.0f, -1.0f, h,  1.0f, 1.0f, h,  1.0f, 1.0f, -h);
     
-    roomWallsVertexCount = (int)(vertices.size() / 3);
-    
-    // Create VBO
-    juce::gl::glGenBuffers (1, &roomWallsVBO);
-    juce::gl::glBindBuffer (juce::gl::GL_ARRAY_BUFFER, roomWallsVBO);
-    juce::gl::glBufferData (juce::gl::GL_ARRAY_BUFFER, 
-                            (GLsizeiptr)(vertices.size() * sizeof(float)), 
-                            vertices.data(), 
-                            juce::gl::GL_STATIC_DRAW);
-    juce::gl::glBindBuffer (juce::gl::GL_ARRAY_BUFFER, 0);
+    return vertices;
 }
 
-void SurroundStageView::createRoomEdgesGeometry()
+std::vector<float> SurroundStageView::createRoomEdgesGeometry()
 {
     // 12 edges of the cuboid (wireframe)
     // X: -1 to +1, Y: -1 to +1, Z: -halfHeight to +halfHeight
@@ -462,19 +1087,10 @@ void SurroundStageView::createRoomEdgesGeometry()
         -1.0f,  1.0f, -h,  -1.0f,  1.0f,  h,  // Front-left
     };
     
-    roomEdgesVertexCount = (int)(vertices.size() / 3);
-    
-    // Create VBO
-    juce::gl::glGenBuffers (1, &roomEdgesVBO);
-    juce::gl::glBindBuffer (juce::gl::GL_ARRAY_BUFFER, roomEdgesVBO);
-    juce::gl::glBufferData (juce::gl::GL_ARRAY_BUFFER, 
-                            (GLsizeiptr)(vertices.size() * sizeof(float)), 
-                            vertices.data(), 
-                            juce::gl::GL_STATIC_DRAW);
-    juce::gl::glBindBuffer (juce::gl::GL_ARRAY_BUFFER, 0);
+    return vertices;
 }
 
-void SurroundStageView::createGridGeometry()
+std::vector<float> SurroundStageView::createGridGeometry()
 {
     const float h = -halfHeight; // Floor level
     const int divisions = gridDivisions;
@@ -495,19 +1111,10 @@ void SurroundStageView::createGridGeometry()
         vertices.insert (vertices.end(), { x, -1.0f, h,  x, 1.0f, h });
     }
     
-    gridVertexCount = (int)(vertices.size() / 3);
-    
-    // Create VBO
-    juce::gl::glGenBuffers (1, &gridVBO);
-    juce::gl::glBindBuffer (juce::gl::GL_ARRAY_BUFFER, gridVBO);
-    juce::gl::glBufferData (juce::gl::GL_ARRAY_BUFFER, 
-                            (GLsizeiptr)(vertices.size() * sizeof(float)), 
-                            vertices.data(), 
-                            juce::gl::GL_STATIC_DRAW);
-    juce::gl::glBindBuffer (juce::gl::GL_ARRAY_BUFFER, 0);
+    return vertices;
 }
 
-void SurroundStageView::createSphereGeometry()
+std::vector<float> SurroundStageView::createSphereGeometry()
 {
     // Create a solid filled sphere representing the listener
     // Using triangle strips for proper depth testing
@@ -564,19 +1171,10 @@ void SurroundStageView::createSphereGeometry()
         }
     }
     
-    sphereVertexCount = (int)(vertices.size() / 3);
-    
-    // Create VBO
-    juce::gl::glGenBuffers (1, &sphereVBO);
-    juce::gl::glBindBuffer (juce::gl::GL_ARRAY_BUFFER, sphereVBO);
-    juce::gl::glBufferData (juce::gl::GL_ARRAY_BUFFER, 
-                            (GLsizeiptr)(vertices.size() * sizeof(float)), 
-                            vertices.data(), 
-                            juce::gl::GL_STATIC_DRAW);
-    juce::gl::glBindBuffer (juce::gl::GL_ARRAY_BUFFER, 0);
+    return vertices;
 }
 
-void SurroundStageView::createFrontLabelGeometry()
+std::vector<float> SurroundStageView::createFrontLabelGeometry()
 {
     // Create "FRONT" text on the front wall (Y = 1.0) using line segments
     // Letters are drawn in the XZ plane at Y = 0.99 (slightly in front of wall)
@@ -635,16 +1233,7 @@ void SurroundStageView::createFrontLabelGeometry()
     addLine(lx, z + letterH/2, lx + letterW, z + letterH/2);          // Top horizontal
     addLine(lx + letterW/2, z - letterH/2, lx + letterW/2, z + letterH/2); // Vertical
     
-    frontLabelVertexCount = (int)(vertices.size() / 3);
-    
-    // Create VBO
-    juce::gl::glGenBuffers (1, &frontLabelVBO);
-    juce::gl::glBindBuffer (juce::gl::GL_ARRAY_BUFFER, frontLabelVBO);
-    juce::gl::glBufferData (juce::gl::GL_ARRAY_BUFFER, 
-                            (GLsizeiptr)(vertices.size() * sizeof(float)), 
-                            vertices.data(), 
-                            juce::gl::GL_STATIC_DRAW);
-    juce::gl::glBindBuffer (juce::gl::GL_ARRAY_BUFFER, 0);
+    return vertices;
 }
 
 //==============================================================================
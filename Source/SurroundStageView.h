@@ -2,7 +2,10 @@
 
 #include <juce_gui_basics/juce_gui_basics.h>
 #include <juce_opengl/juce_opengl.h>
+#include <juce_audio_processors/juce_audio_processors.h>
 #include <array>
+#include <atomic>
+#include <functional>
 
 //==============================================================================
 /**
@@ -12,8 +15,22 @@
  * - Wireframe cuboid room (square floor, shorter height)
  * - Floor grid (4×4)
  * - Listener sphere at center
+ * - Tap pucks at each tap's pan position (size follows its meter level) with
+ *   fading echo trails, all drawn in one instanced call (Pan Field)
  * - Mouse-drag rotation (orbit camera)
- * - View preset support with smooth animation
+ * - View preset support with smooth animation (advanced by the editor's frame scheduler)
+ * 
+ * Rendering is on demand: the GL context never repaints continuously. A frame
+ * is rendered only when the camera moves, a preset transition advances (capped
+ * to a low fixed rate) or invalidateScene() is called, so an idle view costs
+ * nothing. Multisampling steps down from 8x when frames render slowly, and
+ * a level that proved too slow is only retried after a long cooldown.
+ * 
+ * Without OpenGL (no context within a couple of seconds, shader build failure,
+ * or TAPMATRIX_SOFTWARE_3D=1 in the environment) the same geometry is
+ * projected on the CPU and drawn with juce::Graphics. Projected paths are
+ * cached until the camera or size changes; only the tap markers are projected
+ * every paint.
  * 
  * Coordinate system:
  * - X: Left (-1) to Right (+1)
@@ -21,8 +38,7 @@
  * - Z: Floor (-0.6) to Ceiling (+0.6)
  */
 class SurroundStageView : public juce::Component,
-                          public juce::OpenGLRenderer,
-                          private juce::Timer
+                          public juce::OpenGLRenderer
 {
 public:
     //==========================================================================
@@ -39,6 +55,9 @@ public:
     static constexpr int sphereSegments = 8;     // Minimal wireframe
     static constexpr float sphereRadius = 0.08f;  // Small listener marker
     
+    // Taps shown as pucks
+    static constexpr int numTaps = 8;
+    
     //==========================================================================
     // View presets
     enum class ViewPreset
@@ -74,14 +93,35 @@ public:
     void setViewPreset (ViewPreset preset);
     ViewPreset getCurrentPreset() const { return currentPreset; }
     
+    // Advance a view preset transition (called once per frame by the editor)
+    void advanceAnimation (double elapsedSeconds);
+    
+    // Request one render (scene content such as tap positions or meters changed)
+    void invalidateScene();
+    
+    //==========================================================================
+    // Tap pucks
+    /** Where the pucks read their state: tap parameters and a lock-free meter level per tap */
+    void setTapSource (juce::AudioProcessorValueTreeState& apvts, std::function<float (int tapIndex)> tapLevelSource);
+    
+    /** Poll tap parameters and meters and age the echo trails (called once per frame by the editor) */
+    void updateTaps (double elapsedSeconds);
+    
+    //==========================================================================
+    // Software fallback
+    bool isUsingSoftwareRenderer() const { return usingSoftwareRenderer; }
+    
+    /** Time the last software paint took (for benchmarking the fallback) */
+    double getLastSoftwareRenderMs() const { return lastSoftwareRenderMs; }
+    
     // Camera access for external controls
     float getAzimuth() const { return azimuth; }
     float getElevation() const { return elevation; }
     float getZoom() const { return zoom; }
     
-    void setAzimuth (float degrees) { azimuth = degrees; currentPreset = ViewPreset::Custom; }
-    void setElevation (float degrees) { elevation = degrees; currentPreset = ViewPreset::Custom; }
-    void setZoom (float z) { zoom = juce::jlimit (minZoom, maxZoom, z); }
+    void setAzimuth (float degrees) { azimuth = degrees; currentPreset = ViewPreset::Custom; invalidateScene(); }
+    void setElevation (float degrees) { elevation = degrees; currentPreset = ViewPreset::Custom; invalidateScene(); }
+    void setZoom (float z) { zoom = juce::jlimit (minZoom, maxZoom, z); invalidateScene(); }
 
 private:
     //==========================================================================
@@ -138,22 +178,163 @@ private:
     // Animation state
     bool isAnimating = false;
     float animationProgress = 0.0f;
-    float animationSpeed = 0.08f;  // Speed of animation (0-1 per frame)
+    float animationSpeed = 0.08f;  // Speed of animation (0-1 per 60 Hz frame)
     float animationStartAzimuth = 0.0f;
     float animationStartElevation = 0.0f;
     float animationTargetAzimuth = 0.0f;
     float animationTargetElevation = 0.0f;
     
-    // Timer callback for animation
-    void timerCallback() override;
+    // Preset transitions render at this rate rather than every display frame
+    static constexpr double animationFrameSeconds = 1.0 / 30.0;
+    double secondsSinceAnimationFrame = 0.0;
+    
+    //==========================================================================
+    // Adaptive multisampling: the render thread times each frame, the message
+    // thread re-attaches the context when the level changes
+    static constexpr std::array<int, 4> multisamplingLevels { 8, 4, 2, 0 };
+    static constexpr double slowFrameMs = 8.0;   // Smoothed frame time above this: one level down
+    static constexpr double fastFrameMs = 2.0;   // Below this: one level back up
+    static constexpr int framesBeforeMultisamplingChange = 30;
+    static constexpr double multisamplingRetrySeconds = 60.0;  // Before stepping back up to a level that was too slow
+    
+    std::atomic<int> multisamplingIndex { 0 };          // Index into multisamplingLevels
+    std::atomic<bool> multisamplingChangePending { false };
+    double smoothedFrameMs = 0.0;                       // Render thread only
+    int slowFrameCount = 0;
+    int fastFrameCount = 0;
+    int tooSlowMultisamplingIndex = -1;                 // Best level that rendered too slowly (-1 = none)
+    double tooSlowMultisamplingMs = 0.0;                // When it did (kept across re-attaches)
+    
+    void updateMultisampling (double frameMs);          // Render thread
+    void setMultisamplingIndex (int index);             // Message thread
+    void attachContext();
+    
+    //==========================================================================
+    // Tap pucks and echo trails
+    static constexpr int trailLength = 12;                               // Trail points per tap
+    static constexpr int maxTapInstances = numTaps * (1 + trailLength);
+    static constexpr float puckRadius = 0.045f;
+    static constexpr float puckLevelRadius = 0.06f;   // Added at full meter level
+    static constexpr float inactiveGainDb = -60.0f;   // Quieter taps are drawn dimmed and leave no trail
+    static constexpr float inactivePuckAlpha = 0.25f;
+    static constexpr float trailSpacing = 0.03f;      // Puck movement that leaves a trail point
+    static constexpr float trailStartAlpha = 0.5f;
+    static constexpr float minTrailAlpha = 0.02f;
+    static constexpr float trailBaseSeconds = 0.3f;     // Trail fade time at zero feedback...
+    static constexpr float trailFeedbackSeconds = 1.5f; // ...plus this much at full feedback
+    
+    /** Per-instance data streamed to the GPU (the puck shader's instance attributes) */
+    struct TapInstance
+    {
+        float x, y, z;
+        float size;
+        float r, g, b, a;
+    };
+    
+    struct TrailPoint
+    {
+        juce::Vector3D<float> position;
+        float size = 0.0f;
+        float age = 0.0f;
+        float alpha = 0.0f;  // 0 = unused
+    };
+    
+    struct TapState
+    {
+        std::atomic<float>* gain = nullptr;
+        std::atomic<float>* feedback = nullptr;
+        std::atomic<float>* panX = nullptr;
+        std::atomic<float>* panY = nullptr;
+        std::atomic<float>* panZ = nullptr;
+        juce::Colour colour;
+        
+        // Last drawn state (message thread)
+        juce::Vector3D<float> position;
+        float size = 0.0f;
+        bool active = false;
+        
+        juce::Vector3D<float> lastTrailPosition;
+        bool hasTrailPosition = false;
+        std::array<TrailPoint, trailLength> trail;
+        int nextTrailPoint = 0;
+    };
+    
+    std::array<TapState, numTaps> tapStates;
+    std::function<float (int)> getTapLevel;
+    
+    // Built on the message thread, copied by the render thread under the lock
+    juce::SpinLock tapInstanceLock;
+    std::array<TapInstance, maxTapInstances> publishedTapInstances;
+    int numPublishedTapInstances = 0;
+    std::array<TapInstance, maxTapInstances> renderTapInstances;  // Render thread only
+    
+    // Puck shader: camera-facing discs, one quad per instance
+    std::unique_ptr<juce::OpenGLShaderProgram> puckShaderProgram;
+    GLint puckUniformProjection = -1;
+    GLint puckUniformView = -1;
+    GLint puckAttribCorner = -1;
+    GLint puckAttribCentre = -1;
+    GLint puckAttribSize = -1;
+    GLint puckAttribColour = -1;
+    
+    GLuint puckCornerVBO = 0;    // Static quad corners (instanced path)
+    GLuint tapInstanceVBO = 0;   // Rewritten every rendered frame
+    bool useInstancing = false;  // Else one draw call over quads with the instance data repeated per corner
+    std::vector<float> expandedTapVertices;  // Render thread only (non-instanced path)
+    
+    static TapInstance makeTapInstance (juce::Vector3D<float> position, float size, juce::Colour colour, float alpha);
+    bool createPuckShaders();
+    void createTapInstanceBuffers();
+    void drawTapInstances (const juce::Matrix3D<float>& projection, const juce::Matrix3D<float>& view);
+    
+    //==========================================================================
+    // Software fallback
+    static constexpr double contextTimeoutSeconds = 2.0;  // Showing this long without a GL context: fall back
+    
+    std::atomic<bool> contextCreated { false };  // Set by the render thread
+    std::atomic<bool> contextFailed { false };   // Context exists but the shaders didn't build
+    double secondsWaitingForContext = 0.0;
+    bool usingSoftwareRenderer = false;
+    double lastSoftwareRenderMs = 0.0;
+    
+    /** The static scene as xyz vertex arrays (the same arrays the VBOs are built from) */
+    struct SceneGeometry
+    {
+        std::vector<float> roomWalls;   // Triangles
+        std::vector<float> roomEdges;   // Lines
+        std::vector<float> grid;        // Lines
+        std::vector<float> sphere;      // Triangles
+        std::vector<float> frontLabel;  // Lines
+    };
+    
+    SceneGeometry softwareGeometry;
+    
+    /** Static scene projected to the component, valid for one camera and size */
+    struct ProjectedScene
+    {
+        juce::Path roomWalls, roomEdges, grid, sphere, frontLabel;
+        float azimuth = 0.0f, elevation = 0.0f, zoom = 0.0f;
+        juce::Rectangle<int> bounds;
+        bool valid = false;
+    };
+    
+    ProjectedScene projectedScene;
+    
+    void checkRenderer (double elapsedSeconds);
+    void switchToSoftwareRenderer();
+    void updateProjectedScene (const juce::Matrix3D<float>& viewProjection);
+    void paintSoftware (juce::Graphics& g);
     
     //==========================================================================
-    // Geometry generation
-    void createRoomWallsGeometry();  // Solid wall faces for depth
-    void createRoomEdgesGeometry();  // Wireframe edges
-    void createGridGeometry();
-    void createSphereGeometry();
-    void createFrontLabelGeometry();
+    // Geometry generation (xyz triangles or line pairs)
+    static std::vector<float> createRoomWallsGeometry();  // Solid wall faces for depth
+    static std::vector<float> createRoomEdgesGeometry();  // Wireframe edges
+    static std::vector<float> createGridGeometry();
+    static std::vector<float> createSphereGeometry();
+    static std::vector<float> createFrontLabelGeometry();
+    
+    /** Upload vertices to a new static VBO */
+    static GLuint createVertexBuffer (const std::vector<float>& vertices, int& vertexCount);
     
     //==========================================================================
     // Matrix calculations
@@ -164,6 +345,8 @@ private:
     // Shader source
     static const char* vertexShaderSource;
     static const char* fragmentShaderSource;
+    static const char* puckVertexShaderSource;
+    static const char* puckFragmentShaderSource;
     
     //==========================================================================
     // Helper to create shader program
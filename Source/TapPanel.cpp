@@ -166,6 +166,22 @@ void TapPanel::setSliderLookAndFeel (juce::LookAndFeel* lf)
         positionGroup->setSliderLookAndFeel (lf);
 }
 
+void TapPanel::setParameterAttachmentsSuspended (bool shouldBeSuspended)
+{
+    levelFader.setParameterAttachmentSuspended (shouldBeSuspended);
+    timeFader.setParameterAttachmentSuspended (shouldBeSuspended);
+    if (positionGroup)
+        positionGroup->setParameterAttachmentsSuspended (shouldBeSuspended);
+}
+
+void TapPanel::setResizePreview (bool shouldPreview)
+{
+    levelFader.setResizePreview (shouldPreview);
+    timeFader.setResizePreview (shouldPreview);
+    if (positionGroup)
+        positionGroup->setResizePreview (shouldPreview);
+}
+
 int TapPanel::getPreferredHeight() const
 {
     float headerHeight = baseHeaderHeight * currentScaleFactor;
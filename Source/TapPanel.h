@@ -76,7 +76,8 @@ private:
  * - (Future: Position controls, Filter, Diffuse, Drive, Reverb send)
  * 
  * Each tap has its own accent color from the ColorPalette (0-7 → colors 0-7).
- * All 8 panels exist simultaneously; visibility is controlled by TapTabBar selection.
+ * The editor creates a panel the first time its tab is selected; only the
+ * visible panel stays attached to its parameters (see setParameterAttachmentsSuspended).
  */
 class TapPanel : public juce::Component
 {
@@ -108,6 +109,12 @@ public:
     /** Set the custom LookAndFeel for child sliders */
     void setSliderLookAndFeel (juce::LookAndFeel* lf);
     
+    /** Suspend parameter attachments while hidden; resuming refreshes every fader from its parameter */
+    void setParameterAttachmentsSuspended (bool shouldBeSuspended);
+    
+    /** Stretch existing fader frames while the window is being resized (see SliderModule) */
+    void setResizePreview (bool shouldPreview);
+    
 private:
     int tapIndex;                    // 0-7
     juce::Colour accentColour;       // From ColorPalette
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <cmath>
+
+//==============================================================================
+/**
+ * Tape Engine
+ *
+ * Low-cost building blocks for tape mode:
+ * - Recursive quadrature oscillators for wow and flutter (no std::sin per sample)
+ * - Table-driven tanh waveshaper for feedback saturation
+ * - Block-constant coefficients so the per-sample loop is multiply/add only
+ */
+namespace TapeEngine
+{
+    // Modulation rates (Hz) - each tap is detuned slightly so repeats drift independently
+    static constexpr float wowRateHz = 0.55f;
+    static constexpr float flutterRateHz = 6.8f;
+    static constexpr float tapRateSpread = 0.07f;  // +7% per tap index
+
+    // Maximum modulation depth at 100% amount
+    static constexpr float maxWowDepthMs = 2.0f;
+    static constexpr float maxFlutterDepthMs = 0.15f;
+
+    // Delay time glide: ~10ms time constant, read head speed limited to 0x..2x
+    static constexpr float glideTimeSeconds = 0.010f;
+    static constexpr float maxSpeedDeviation = 1.0f;  // Max change in delay samples per sample
+
+    // Saturation drive at 100% amount
+    static constexpr float maxSaturationDrive = 6.0f;
+
+    //==============================================================================
+    /**
+     * Recursive quadrature oscillator (rotating phasor)
+     *
+     * Advances with 4 multiplies per sample. Amplitude drift from rounding
+     * is corrected once per block with renormalise().
+     */
+    struct QuadratureOscillator
+    {
+        float sinValue = 0.0f;
+        float cosValue = 1.0f;
+        float rotSin = 0.0f;
+        float rotCos = 1.0f;
+
+        void setFrequency (float frequencyHz, double sampleRate)
+        {
+            const double w = juce::MathConstants<double>::twoPi * frequencyHz / sampleRate;
+            rotSin = static_cast<float> (std::sin (w));
+            rotCos = static_cast<float> (std::cos (w));
+        }
+
+        void setPhase (float radians)
+        {
+            sinValue = std::sin (radians);
+            cosValue = std::cos (radians);
+        }
+
+        /** Returns the current sine value and rotates the phasor by one sample */
+        float advance() noexcept
+        {
+            const float s = sinValue;
+            sinValue = s * rotCos + cosValue * rotSin;
+            cosValue = cosValue * rotCos - s * rotSin;
+            return s;
+        }
+
+        /** Pull the phasor back onto the unit circle (first-order, call once per block) */
+        void renormalise() noexcept
+        {
+            const float gain = 1.5f - 0.5f * (sinValue * sinValue + cosValue * cosValue);
+            sinValue *= gain;
+            cosValue *= gain;
+        }
+    };
+
+    //==============================================================================
+    /**
+     * Table-driven tanh waveshaper
+     *
+     * Shared, read-only table (built once per process) with linear interpolation.
+     * Inputs outside the table range clamp to the table edges (|tanh| > 0.999).
+     */
+    class SaturationTable
+    {
+    public:
+        static const SaturationTable& getInstance()
+        {
+            static const SaturationTable instance;
+            return instance;
+        }
+
+        float process (float x) const noexcept
+        {
+            const float position = (juce::jlimit (-inputRange, inputRange, x) + inputRange) * indexScale;
+            const int index = juce::jmin (static_cast<int> (position), tableSize - 1);
+            const float frac = position - static_cast<float> (index);
+            return table[index] + frac * (table[index + 1] - table[index]);
+        }
+
+    private:
+        static constexpr int tableSize = 1024;
+        static constexpr float inputRange = 4.0f;
+        static constexpr float indexScale = tableSize / (2.0f * inputRange);
+
+        SaturationTable()
+        {
+            for (int i = 0; i <= tableSize; ++i)
+                table[i] = std::tanh (static_cast<float> (i) / indexScale - inputRange);
+        }
+
+        std::array<float, tableSize + 1> table;  // +1 guard point for interpolation
+    };
+
+    //==============================================================================
+    /**
+     * Per-tap tape transport (wow + flutter oscillators)
+     */
+    struct TapeTransport
+    {
+        QuadratureOscillator wow;
+        QuadratureOscillator flutter;
+
+        void prepare (int tapIndex, double sampleRate)
+        {
+            const float rateScale = 1.0f + tapRateSpread * static_cast<float> (tapIndex);
+            wow.setFrequency (wowRateHz * rateScale, sampleRate);
+            flutter.setFrequency (flutterRateHz * rateScale, sampleRate);
+            reset (tapIndex);
+        }
+
+        void reset (int tapIndex)
+        {
+            // Golden-angle phase offsets keep the taps decorrelated
+            const float phase = 2.39996f * static_cast<float> (tapIndex);
+            wow.setPhase (phase);
+            flutter.setPhase (phase * 3.0f);
+        }
+    };
+
+    //==============================================================================
+    /**
+     * Tape coefficients - computed once per block, constant inside the sample loop
+     */
+    struct BlockCoefficients
+    {
+        float smoothingCoeff = 1.0f;        // Delay glide (one-pole)
+        float maxSlewSamples = 1.0f;        // Read head speed limit
+        float wowDepthSamples = 0.0f;
+        float flutterDepthSamples = 0.0f;
+        float saturationDrive = 1.0f;
+        float saturationMakeup = 1.0f;      // 1 / drive, keeps small-signal loop gain at unity
+        bool saturate = false;
+
+        void update (double sampleRate, float wowAmount, float flutterAmount, float saturationAmount)
+        {
+            const float sr = static_cast<float> (sampleRate);
+            smoothingCoeff = 1.0f - std::exp (-1.0f / (glideTimeSeconds * sr));
+            maxSlewSamples = maxSpeedDeviation;
+            wowDepthSamples = wowAmount * maxWowDepthMs * 0.001f * sr;
+            flutterDepthSamples = flutterAmount * maxFlutterDepthMs * 0.001f * sr;
+            saturate = saturationAmount > 0.001f;
+            saturationDrive = 1.0f + saturationAmount * (maxSaturationDrive - 1.0f);
+            saturationMakeup = 1.0f / saturationDrive;
+        }
+    };
+}
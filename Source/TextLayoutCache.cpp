@@ -0,0 +1,76 @@
+#include "TextLayoutCache.h"
+
+//==============================================================================
+JUCE_IMPLEMENT_SINGLETON (TextLayoutCache)
+
+TextLayoutCache::~TextLayoutCache()
+{
+    clearSingletonInstance();
+}
+
+void TextLayoutCache::drawText (juce::Graphics& g, const juce::String& text, float fontHeight, int styleFlags,
+                                juce::Rectangle<float> area, juce::Justification justification)
+{
+    if (text.isEmpty())
+        return;
+
+    const auto& entry = getEntry (text, fontHeight, styleFlags, area.getWidth());
+
+    // Same placement as Graphics::drawText(): the glyphs' bounding box is justified within the area
+    const auto placed = justification.appliedToRectangle (entry.bounds, area);
+    entry.glyphs.draw (g, juce::AffineTransform::translation (placed.getX() - entry.bounds.getX(),
+                                                               placed.getY() - entry.bounds.getY()));
+}
+
+float TextLayoutCache::getStringWidth (const juce::String& text, float fontHeight, int styleFlags)
+{
+    if (text.isEmpty())
+        return 0.0f;
+
+    return getEntry (text, fontHeight, styleFlags, unlimitedWidth).bounds.getWidth();
+}
+
+//==============================================================================
+const TextLayoutCache::Entry& TextLayoutCache::getEntry (const juce::String& text, float fontHeight, int styleFlags, float maxWidth)
+{
+    EntryKey key { text, fontHeight, styleFlags, maxWidth };
+
+    if (auto found = lookup.find (key); found != lookup.end())
+    {
+        entries.splice (entries.begin(), entries, found->second);
+        return *found->second;
+    }
+
+    Entry entry { std::move (key), {}, {} };
+    const auto& font = getFont (fontHeight, styleFlags);
+
+    // Like Graphics::drawText(), drop whatever doesn't fit rather than overflowing the area
+    if (maxWidth == unlimitedWidth)
+        entry.glyphs.addLineOfText (font, text, 0.0f, 0.0f);
+    else
+        entry.glyphs.addCurtailedLineOfText (font, text, 0.0f, 0.0f, maxWidth, false);
+
+    entry.bounds = entry.glyphs.getBoundingBox (0, -1, true);
+
+    entries.push_front (std::move (entry));
+    lookup[entries.front().key] = entries.begin();
+
+    // Drop the least recently drawn strings (old values, sizes no longer shown)
+    while (entries.size() > maxEntries)
+    {
+        lookup.erase (entries.back().key);
+        entries.pop_back();
+    }
+
+    return entries.front();
+}
+
+const juce::Font& TextLayoutCache::getFont (float fontHeight, int styleFlags)
+{
+    const auto key = std::make_pair (fontHeight, styleFlags);
+
+    if (auto found = fonts.find (key); found != fonts.end())
+        return found->second;
+
+    return fonts.emplace (key, juce::Font (juce::FontOptions (fontHeight, styleFlags))).first->second;
+}
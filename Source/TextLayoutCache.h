@@ -0,0 +1,85 @@
+#pragma once
+
+#include <juce_graphics/juce_graphics.h>
+#include <juce_events/juce_events.h>
+#include <list>
+#include <map>
+
+/**
+ * Laid-out single-line text, shared by every component in the process
+ *
+ * Graphics::drawText() shapes its string into glyphs on every call. Fader
+ * value readouts repaint constantly during automation but only ever show a
+ * few hundred distinct strings per size ("-6.0dB", "250ms", "1/8D", ...), so
+ * each (text, size, style, width) is laid out once here and kept in a small
+ * least-recently-used cache. A value that changes simply looks up (or lays
+ * out) its new string; entries for other strings are untouched.
+ *
+ * Glyph arrangements are resolution independent, so one entry serves every
+ * display scale the same font size is drawn at; JUCE's own glyph cache takes
+ * care of rasterising.
+ *
+ * Released with the other GUI singletons at shutdown (entries hold typefaces).
+ * Not thread-safe: use from the message thread only.
+ */
+class TextLayoutCache : public juce::DeletedAtShutdown
+{
+public:
+    //==========================================================================
+    ~TextLayoutCache() override;
+
+    JUCE_DECLARE_SINGLETON (TextLayoutCache, false)
+
+    /**
+     * Draw one line of text justified within an area, like Graphics::drawText()
+     * without ellipses: glyphs that don't fit the area's width are dropped.
+     * styleFlags are juce::Font::FontStyleFlags.
+     */
+    void drawText (juce::Graphics& g, const juce::String& text, float fontHeight, int styleFlags,
+                   juce::Rectangle<float> area, juce::Justification justification);
+
+    /** Width of one line of text (including trailing whitespace) */
+    float getStringWidth (const juce::String& text, float fontHeight, int styleFlags);
+
+private:
+    //==========================================================================
+    static constexpr size_t maxEntries = 1024;
+
+    static constexpr float unlimitedWidth = -1.0f;
+
+    struct EntryKey
+    {
+        juce::String text;
+        float fontHeight;
+        int styleFlags;
+        float maxWidth;  // Glyphs beyond this are dropped (unlimitedWidth = none)
+
+        bool operator< (const EntryKey& other) const
+        {
+            if (fontHeight != other.fontHeight) return fontHeight < other.fontHeight;
+            if (styleFlags != other.styleFlags) return styleFlags < other.styleFlags;
+            if (maxWidth != other.maxWidth) return maxWidth < other.maxWidth;
+            return text < other.text;
+        }
+    };
+
+    struct Entry
+    {
+        EntryKey key;
+        juce::GlyphArrangement glyphs;  // Laid out with its first baseline at y = 0
+        juce::Rectangle<float> bounds;  // Of the glyphs, including whitespace
+    };
+
+    // Most recently used at the front
+    std::list<Entry> entries;
+    std::map<EntryKey, std::list<Entry>::iterator> lookup;
+
+    // Fonts are looked up by size and style rather than rebuilt for every string
+    std::map<std::pair<float, int>, juce::Font> fonts;
+
+    TextLayoutCache() = default;
+    const Entry& getEntry (const juce::String& text, float fontHeight, int styleFlags, float maxWidth);
+    const juce::Font& getFont (float fontHeight, int styleFlags);
+
+    JUCE_DECLARE_NON_COPYABLE (TextLayoutCache)
+};
@@ -0,0 +1,370 @@
+#include "UserPresetBank.h"
+#include "BinaryStateFormat.h"
+#include <algorithm>
+#include <limits>
+#include <map>
+
+//==============================================================================
+/**
+ * Background folder watcher - rescans periodically, or immediately when notified
+ */
+class UserPresetBank::Scanner : public juce::Thread
+{
+public:
+    static constexpr int scanIntervalMs = 5000;
+
+    explicit Scanner (UserPresetBank& bankToUpdate)
+        : juce::Thread ("TapMatrix Preset Scanner"), owner (bankToUpdate) {}
+
+    void run() override
+    {
+        while (! threadShouldExit())
+        {
+            if (owner.mergeFolderIntoBank())
+            {
+                owner.swapPending = true;
+                owner.triggerAsyncUpdate();
+            }
+            else if (owner.swapPending)
+            {
+                // The message thread couldn't get the bank lock last time - try again
+                owner.triggerAsyncUpdate();
+            }
+
+            wait (scanIntervalMs);
+        }
+    }
+
+private:
+    UserPresetBank& owner;
+};
+
+//==============================================================================
+UserPresetBank::UserPresetBank()
+    : bankFile (getBankFile()),
+      presetFolder (getPresetFolder())
+{
+    presetFolder.createDirectory();
+
+    // O(1): map the existing bank, decode records on demand
+    bank.open (bankFile);
+
+    scanner = std::make_unique<Scanner> (*this);
+    scanner->startThread (juce::Thread::Priority::background);
+}
+
+UserPresetBank::~UserPresetBank()
+{
+    scanner->stopThread (4000);
+    cancelPendingUpdate();
+}
+
+juce::File UserPresetBank::getBankFile()
+{
+    return juce::File::getSpecialLocation (juce::File::userApplicationDataDirectory)
+               .getChildFile ("ClipPoint").getChildFile ("TapMatrix").getChildFile ("UserPresets.tmxbank");
+}
+
+juce::File UserPresetBank::getPresetFolder()
+{
+    return juce::File::getSpecialLocation (juce::File::userApplicationDataDirectory)
+               .getChildFile ("ClipPoint").getChildFile ("TapMatrix").getChildFile ("Presets");
+}
+
+//==============================================================================
+int UserPresetBank::getNumPresets() const
+{
+    const juce::ScopedLock sl (bankLock);
+    return bank.numRecords;
+}
+
+juce::String UserPresetBank::getPresetName (int index) const
+{
+    const juce::ScopedLock sl (bankLock);
+    if (! juce::isPositiveAndBelow (index, bank.numRecords))
+        return {};
+
+    return bank.getString (bank.getRecord (index), 0);
+}
+
+juce::String UserPresetBank::getPresetTags (int index) const
+{
+    const juce::ScopedLock sl (bankLock);
+    if (! juce::isPositiveAndBelow (index, bank.numRecords))
+        return {};
+
+    return bank.getString (bank.getRecord (index), 1);
+}
+
+int UserPresetBank::getPresetValues (int index, float* dest, int maxValues) const
+{
+    const juce::ScopedLock sl (bankLock);
+    if (! juce::isPositiveAndBelow (index, bank.numRecords))
+        return 0;
+
+    const auto* values = bank.getRecord (index) + recordHeaderSize;
+    const int numToCopy = juce::jmin (maxValues, bank.numValues);
+
+    for (int i = 0; i < numToCopy; ++i)
+        dest[i] = BinaryStateFormat::readFloat (values + sizeof (float) * static_cast<size_t> (i));
+
+    return numToCopy;
+}
+
+//==============================================================================
+bool UserPresetBank::savePreset (const juce::String& name, const juce::MemoryBlock& stateData)
+{
+    const auto file = presetFolder.getChildFile (juce::File::createLegalFileName (name) + presetFileExtension);
+
+    if (! presetFolder.createDirectory() || ! file.replaceWithData (stateData.getData(), stateData.getSize()))
+        return false;
+
+    rescan();
+    return true;
+}
+
+void UserPresetBank::rescan()
+{
+    scanner->notify();
+}
+
+//==============================================================================
+bool UserPresetBank::MappedBank::open (const juce::File& fileToMap)
+{
+    *this = {};
+
+    if (! fileToMap.existsAsFile())
+        return false;
+
+    auto mapped = std::make_unique<juce::MemoryMappedFile> (fileToMap, juce::MemoryMappedFile::readOnly);
+    const auto* data = static_cast<const unsigned char*> (mapped->getData());
+    const auto size = static_cast<juce::uint64> (mapped->getSize());
+
+    if (data == nullptr || size < static_cast<juce::uint64> (headerSize))
+        return false;
+
+    using BinaryStateFormat::readUint32;
+
+    if (readUint32 (data) != magic || readUint32 (data + 8) < static_cast<juce::uint32> (headerSize))
+        return false;
+
+    const juce::uint64 fileHeaderSize = readUint32 (data + 8);
+    const juce::uint64 count = readUint32 (data + 12);
+    const juce::uint64 valueCount = readUint32 (data + 16);
+    const juce::uint64 stride = readUint32 (data + 20);
+    const juce::uint64 stringOffset = readUint32 (data + 24);
+    const juce::uint64 stringSize = readUint32 (data + 28);
+
+    // Records must hold their values, and everything must lie inside the file
+    if (stride < static_cast<juce::uint64> (recordHeaderSize) + sizeof (float) * valueCount
+        || fileHeaderSize + count * stride > stringOffset
+        || stringOffset + stringSize > size)
+        return false;
+
+    records = data + fileHeaderSize;
+    strings = reinterpret_cast<const char*> (data + stringOffset);
+    stringTableSize = static_cast<juce::uint32> (stringSize);
+    numRecords = static_cast<int> (count);
+    numValues = static_cast<int> (valueCount);
+    recordSize = static_cast<int> (stride);
+    file = std::move (mapped);
+    return true;
+}
+
+juce::String UserPresetBank::MappedBank::getString (const unsigned char* record, int field) const
+{
+    const auto offset = BinaryStateFormat::readUint32 (record + field * 8);
+    const auto length = BinaryStateFormat::readUint32 (record + field * 8 + 4);
+
+    if (static_cast<juce::uint64> (offset) + length > stringTableSize)
+        return {};
+
+    return juce::String::fromUTF8 (strings + offset, static_cast<int> (length));
+}
+
+juce::int64 UserPresetBank::MappedBank::getModificationTime (const unsigned char* record) const
+{
+    const auto low = static_cast<juce::uint64> (BinaryStateFormat::readUint32 (record + 24));
+    const auto high = static_cast<juce::uint64> (BinaryStateFormat::readUint32 (record + 28));
+    return static_cast<juce::int64> (low | (high << 32));
+}
+
+//==============================================================================
+bool UserPresetBank::mergeFolderIntoBank()
+{
+    // Wait for the message thread to pick up the previous merge
+    if (swapPending)
+        return false;
+
+    // Read the current bank through a private mapping (the shared one may be swapped meanwhile).
+    // The bank file lock is only taken to write the result, so it is never held for a whole scan.
+    const auto bankTimeAtRead = bankFile.getLastModificationTime();
+    MappedBank existing;
+    existing.open (bankFile);
+
+    std::map<juce::String, int> existingRecords;
+    for (int i = 0; i < existing.numRecords; ++i)
+        existingRecords[existing.getString (existing.getRecord (i), 2)] = i;
+
+    struct Entry
+    {
+        juce::String name, tags, path;
+        juce::int64 modificationTime = 0;
+        int existingRecord = -1;
+        std::vector<float> values;  // Only for new or changed files
+    };
+
+    std::vector<Entry> entries;
+    bool changed = false;
+    int maxValues = existing.numValues;
+
+    for (const auto& file : presetFolder.findChildFiles (juce::File::findFiles, true, juce::String ("*") + presetFileExtension))
+    {
+        if (scanner->threadShouldExit())
+            return false;
+
+        Entry entry;
+        entry.path = file.getRelativePathFrom (presetFolder).replaceCharacter ('\\', '/');
+        entry.name = file.getFileNameWithoutExtension();
+        entry.tags = file.getParentDirectory().getRelativePathFrom (presetFolder).replaceCharacter ('\\', '/');
+        if (entry.tags == ".")
+            entry.tags = {};
+        entry.modificationTime = file.getLastModificationTime().toMilliseconds();
+
+        auto found = existingRecords.find (entry.path);
+        const int existingRecord = found != existingRecords.end() ? found->second : -1;
+        if (found != existingRecords.end())
+            existingRecords.erase (found);
+
+        if (existingRecord >= 0 && existing.getModificationTime (existing.getRecord (existingRecord)) == entry.modificationTime)
+        {
+            // Unchanged: reuse the bank's values without touching the file
+            entry.existingRecord = existingRecord;
+        }
+        else
+        {
+            juce::MemoryBlock data;
+            BinaryStateFormat::ParsedState state;
+
+            if (! file.loadFileAsData (data)
+                || ! BinaryStateFormat::parse (data.getData(), static_cast<int> (data.getSize()), state))
+                continue;  // Not a preset (or still being written) - retried on the next scan
+
+            entry.values.resize (static_cast<size_t> (state.numValues));
+            for (int i = 0; i < state.numValues; ++i)
+                entry.values[static_cast<size_t> (i)] = state.getValue (i);
+
+            maxValues = juce::jmax (maxValues, state.numValues);
+            changed = true;
+        }
+
+        entries.push_back (std::move (entry));
+    }
+
+    // Anything left in existingRecords was deleted from the folder (or is no longer readable)
+    if (! changed && existingRecords.empty() && static_cast<int> (entries.size()) == existing.numRecords)
+        return false;
+
+    std::sort (entries.begin(), entries.end(), [] (const Entry& a, const Entry& b)
+    {
+        return a.name.compareNatural (b.name) < 0;
+    });
+
+    //==========================================================================
+    // Write the merged bank
+    const int recordSize = recordHeaderSize + static_cast<int> (sizeof (float)) * maxValues;
+    const auto stringTableOffset = static_cast<size_t> (headerSize) + entries.size() * static_cast<size_t> (recordSize);
+
+    juce::MemoryBlock output (stringTableOffset, true);
+    juce::MemoryOutputStream stringTable;
+
+    auto addString = [&stringTable] (unsigned char* dest, const juce::String& text)
+    {
+        const auto utf8 = text.toUTF8();
+        const auto length = utf8.sizeInBytes() - 1;
+        BinaryStateFormat::writeUint32 (dest, static_cast<juce::uint32> (stringTable.getDataSize()));
+        BinaryStateFormat::writeUint32 (dest + 4, static_cast<juce::uint32> (length));
+        stringTable.write (utf8.getAddress(), length);
+    };
+
+    auto* bytes = static_cast<unsigned char*> (output.getData());
+
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        const auto& entry = entries[i];
+        auto* record = bytes + headerSize + i * static_cast<size_t> (recordSize);
+
+        addString (record, entry.name);
+        addString (record + 8, entry.tags);
+        addString (record + 16, entry.path);
+
+        const auto time = static_cast<juce::uint64> (entry.modificationTime);
+        BinaryStateFormat::writeUint32 (record + 24, static_cast<juce::uint32> (time & 0xffffffffu));
+        BinaryStateFormat::writeUint32 (record + 28, static_cast<juce::uint32> (time >> 32));
+
+        auto* values = record + recordHeaderSize;
+        for (int v = 0; v < maxValues; ++v)
+        {
+            float value = std::numeric_limits<float>::quiet_NaN();
+
+            if (entry.existingRecord >= 0)
+            {
+                if (v < existing.numValues)
+                    value = BinaryStateFormat::readFloat (existing.getRecord (entry.existingRecord) + recordHeaderSize + sizeof (float) * static_cast<size_t> (v));
+            }
+            else if (v < static_cast<int> (entry.values.size()))
+            {
+                value = entry.values[static_cast<size_t> (v)];
+            }
+
+            BinaryStateFormat::writeFloat (values + sizeof (float) * static_cast<size_t> (v), value);
+        }
+    }
+
+    BinaryStateFormat::writeUint32 (bytes, magic);
+    BinaryStateFormat::writeUint32 (bytes + 4, currentVersion);
+    BinaryStateFormat::writeUint32 (bytes + 8, static_cast<juce::uint32> (headerSize));
+    BinaryStateFormat::writeUint32 (bytes + 12, static_cast<juce::uint32> (entries.size()));
+    BinaryStateFormat::writeUint32 (bytes + 16, static_cast<juce::uint32> (maxValues));
+    BinaryStateFormat::writeUint32 (bytes + 20, static_cast<juce::uint32> (recordSize));
+    BinaryStateFormat::writeUint32 (bytes + 24, static_cast<juce::uint32> (stringTableOffset));
+    BinaryStateFormat::writeUint32 (bytes + 28, static_cast<juce::uint32> (stringTable.getDataSize()));
+
+    output.append (stringTable.getData(), stringTable.getDataSize());
+
+    const juce::InterProcessLock::ScopedLockType processLock (bankFileLock);
+    if (! processLock.isLocked())
+        return false;
+
+    // Another instance replaced the bank while this one was scanning - merge again next time
+    if (bankFile.getLastModificationTime() != bankTimeAtRead)
+        return false;
+
+    bankFile.getParentDirectory().createDirectory();
+    return getPendingBankFile().replaceWithData (output.getData(), output.getSize());
+}
+
+void UserPresetBank::handleAsyncUpdate()
+{
+    {
+        // Never wait on the message thread: another instance may be writing its pending bank.
+        // If the lock is busy the swap stays pending and the scanner retries on its next pass.
+        if (! bankFileLock.enter (bankLockTimeoutMs))
+            return;
+
+        const juce::ScopedLock sl (bankLock);
+
+        // Unmap before replacing (required on Windows). If the move fails (another
+        // process still maps the bank) the old bank is reopened and the next scan retries.
+        bank = {};
+
+        if (getPendingBankFile().existsAsFile())
+            getPendingBankFile().moveFileTo (bankFile);
+
+        bank.open (bankFile);
+        bankFileLock.exit();
+    }
+
+    swapPending = false;
+    sendChangeMessage();
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <juce_events/juce_events.h>
+#include <atomic>
+#include <memory>
+
+/**
+ * User preset bank
+ *
+ * All user presets live in one memory-mapped bank file:
+ *
+ *   header   (magic "TMXK", version, sizes - all little-endian)
+ *   records  numRecords x fixed-size record:
+ *              name / tags / source file (string table offset + length each)
+ *              source file modification time (int64)
+ *              float values[numValues] (plain, stable parameter order;
+ *                                       NaN where a preset file held fewer)
+ *   strings  UTF-8 string table
+ *
+ * Opening the bank only maps the file and checks the header; records are
+ * decoded on demand. A background thread watches the preset folder for
+ * *.tmxpreset files (binary plugin state), merges new or changed files into
+ * a fresh bank and hands it to the message thread, which swaps it in and
+ * sends a change message.
+ *
+ * One bank is shared by all plugin instances in a process (use it through
+ * juce::SharedResourcePointer); an inter-process lock serialises bank writes
+ * between hosts.
+ */
+class UserPresetBank : public juce::ChangeBroadcaster,
+                       private juce::AsyncUpdater
+{
+public:
+    //==========================================================================
+    static constexpr const char* presetFileExtension = ".tmxpreset";
+
+    //==========================================================================
+    UserPresetBank();
+    ~UserPresetBank() override;
+
+    // Per-user locations
+    static juce::File getBankFile();
+    static juce::File getPresetFolder();
+
+    //==========================================================================
+    // Bank access (any thread)
+    int getNumPresets() const;
+    juce::String getPresetName (int index) const;
+    juce::String getPresetTags (int index) const;
+
+    // Copies up to maxValues plain values and returns the number copied.
+    // Values missing from older preset files are NaN - callers substitute defaults.
+    int getPresetValues (int index, float* dest, int maxValues) const;
+
+    //==========================================================================
+    // Write a preset file into the preset folder and wake the scanner (message thread)
+    bool savePreset (const juce::String& name, const juce::MemoryBlock& stateData);
+
+    // Wake the scanner for an immediate rescan
+    void rescan();
+
+private:
+    //==========================================================================
+    class Scanner;
+
+    //==========================================================================
+    // Bank file layout
+    static constexpr juce::uint32 magic = 0x4b584d54;  // "TMXK"
+    static constexpr juce::uint32 currentVersion = 1;
+    static constexpr int headerSize = 32;
+    static constexpr int recordHeaderSize = 32;
+
+    struct MappedBank
+    {
+        std::unique_ptr<juce::MemoryMappedFile> file;
+        const unsigned char* records = nullptr;
+        const char* strings = nullptr;
+        juce::uint32 stringTableSize = 0;
+        int numRecords = 0;
+        int numValues = 0;
+        int recordSize = 0;
+
+        bool open (const juce::File& bankFile);
+        const unsigned char* getRecord (int index) const { return records + static_cast<size_t> (index) * static_cast<size_t> (recordSize); }
+        juce::String getString (const unsigned char* record, int field) const;
+        juce::int64 getModificationTime (const unsigned char* record) const;
+    };
+
+    //==========================================================================
+    const juce::File bankFile;
+    const juce::File presetFolder;
+
+    static constexpr int bankLockTimeoutMs = 20;  // Longest the message thread waits for the bank file lock
+    juce::InterProcessLock bankFileLock { "TapMatrixUserPresetBank" };
+    juce::CriticalSection bankLock;
+    MappedBank bank;
+
+    std::atomic<bool> swapPending { false };
+    std::unique_ptr<Scanner> scanner;
+
+    //==========================================================================
+    juce::File getPendingBankFile() const { return bankFile.withFileExtension ("tmxbank.new"); }
+
+    // Scanner thread: returns true if a new bank was written to the pending file
+    bool mergeFolderIntoBank();
+
+    void handleAsyncUpdate() override;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (UserPresetBank)
+};
@@ -3,13 +3,10 @@
 //==============================================================================
 ViewPresetSelector::ViewPresetSelector()
 {
-    // Start animation timer (60 FPS)
-    startTimerHz (60);
 }
 
 ViewPresetSelector::~ViewPresetSelector()
 {
-    stopTimer();
 }
 
 //==============================================================================
@@ -20,20 +17,20 @@ void ViewPresetSelector::setCurrentPreset (SurroundStageView::ViewPreset preset)
     {
         if (presets[i] == preset)
         {
-            currentIndex = i;
-            targetPosition = (float)i;
-            isCustom = false;
-            repaint();
+            if (currentIndex != i || isCustom)
+            {
+                currentIndex = i;
+                targetPosition = (float)i;
+                isCustom = false;
+                repaint();
+            }
             return;
         }
     }
     
     // If preset is Custom, just dim the current selection
     if (preset == SurroundStageView::ViewPreset::Custom)
-    {
-        isCustom = true;
-        repaint();
-    }
+        setCustomState (true);
 }
 
 void ViewPresetSelector::setCustomState (bool custom)
@@ -115,20 +112,26 @@ void ViewPresetSelector::mouseDown (const juce::MouseEvent& event)
 }
 
 //==============================================================================
-void ViewPresetSelector::timerCallback()
+void ViewPresetSelector::advanceAnimation (double elapsedSeconds)
 {
+    if (pillPosition == targetPosition)
+        return;
+    
+    const auto previousPill = getPillBounds();
+    
     // Animate pill position toward target
     if (std::abs (pillPosition - targetPosition) > 0.001f)
     {
         // Ease-out animation
-        pillPosition += (targetPosition - pillPosition) * animationSpeed;
-        repaint();
+        pillPosition += (targetPosition - pillPosition) * FrameScheduler::getEasingAmount (animationSpeed, elapsedSeconds);
     }
-    else if (pillPosition != targetPosition)
+    else
     {
         pillPosition = targetPosition;
-        repaint();
     }
+    
+    // Only the strip the pill swept needs redrawing (labels underneath included)
+    repaint (previousPill.getUnion (getPillBounds()).expanded (1.0f).getSmallestIntegerContainer());
 }
 
 juce::Rectangle<float> ViewPresetSelector::getSegmentBounds (int index) const
@@ -3,6 +3,7 @@
 #include <juce_gui_basics/juce_gui_basics.h>
 #include "SurroundStageView.h"
 #include "ColorPalette.h"
+#include "FrameScheduler.h"
 
 /**
  * Segmented control for selecting view presets
@@ -11,9 +12,11 @@
  * - 5 preset options: Angle, Left, Top, Right, Back
  * - Animated pill selector that slides between options
  * - Dims when view is in "Custom" state (user has dragged to rotate)
+ *
+ * Animated by the editor's frame scheduler; while the pill moves only the
+ * area it sweeps is repainted.
  */
-class ViewPresetSelector : public juce::Component,
-                           public juce::Timer
+class ViewPresetSelector : public juce::Component
 {
 public:
     //==========================================================================
@@ -21,7 +24,7 @@ public:
     static constexpr float cornerRadius = 5.0f;
     static constexpr float borderWidth = 1.0f;
     static constexpr float pillPadding = 2.0f;
-    static constexpr float animationSpeed = 0.15f;  // 0-1 progress per frame
+    static constexpr float animationSpeed = 0.15f;  // 0-1 progress per 60 Hz frame
     static constexpr float baseFontSize = 12.0f;    // Font size at 1.0x scale
     
     //==========================================================================
@@ -44,6 +47,9 @@ public:
     // Get the current scale factor
     float getScaleFactor() const { return currentScaleFactor; }
     
+    // Advance the pill animation (called once per frame by the editor)
+    void advanceAnimation (double elapsedSeconds);
+    
     //==========================================================================
     void paint (juce::Graphics& g) override;
     void resized() override;
@@ -71,9 +77,6 @@ private:
     float currentScaleFactor = 1.0f; // UI scale factor (1.0 to 3.0)
     
     //==========================================================================
-    // Animation
-    void timerCallback() override;
-    
     // Get the bounds for a specific segment
     juce::Rectangle<float> getSegmentBounds (int index) const;
     